@@ -0,0 +1,111 @@
+#pragma once
+#include <Arduino.h>
+
+// CPU clock profiles switched at run time by load.
+//
+// Every profile runs the timers at HCLK (APB1 divided only at 72 MHz, where
+// TIM2-4 get it doubled back), so a timer clock is always the profile's
+// frequency. select() switches inside one critical section and keeps time:
+// the SysTick millisecond in progress is finished at the new rate, so
+// millis() and micros() run on without a step, and then the listener
+// retunes whatever else counts bus clocks (tone and sampler timers, USART
+// baud rates, the I2C clock).
+//
+// A new PLL multiplier needs the PLL off, so such a switch goes through
+// the 8 MHz HSE profile and waits for the PLL to lock, up to 200 us with
+// interrupts off; switches between 72 and 36 MHz only change dividers.
+//
+// Load is the share of loop time spent outside idle(), measured over
+// CLOCK_WINDOW_MS and scaled to the other profiles by frequency, which
+// overstates it for bus-bound work and so errs on the fast side.
+
+#define CLOCK_WINDOW_MS 500
+#define CLOCK_LOAD_TARGET 50 // percent, a slower profile must stay under it
+#define CLOCK_LOAD_HIGH 75   // percent, above it the next faster profile that fits
+
+enum ClockProfileIndex : uint8_t { CLOCK_72MHZ, CLOCK_36MHZ, CLOCK_24MHZ, CLOCK_8MHZ, CLOCK_PROFILES };
+
+struct ClockProfile {
+  uint32_t hz;
+  uint8_t pllMul;  // of the 8 MHz HSE; 0 runs from the HSE, PLL off
+  uint32_t hpre;   // AHB divider, RCC_CFGR_HPRE_DIVn
+  uint32_t ppre1;  // APB1 divider, which must stay at or under 36 MHz
+  uint8_t latency; // flash wait states
+  uint16_t typicalMa10; // datasheet typical run current, peripherals on, 0.1 mA
+};
+
+constexpr ClockProfile clockProfiles[CLOCK_PROFILES] = {
+    {72000000, 9, RCC_CFGR_HPRE_DIV1, RCC_CFGR_PPRE1_DIV2, 2, 361},
+    {36000000, 9, RCC_CFGR_HPRE_DIV2, RCC_CFGR_PPRE1_DIV1, 1, 190},
+    {24000000, 3, RCC_CFGR_HPRE_DIV1, RCC_CFGR_PPRE1_DIV1, 0, 129},
+    {8000000, 0, RCC_CFGR_HPRE_DIV1, RCC_CFGR_PPRE1_DIV1, 0, 55},
+};
+
+// APB1 clock of a profile; APB2 always runs at HCLK
+constexpr uint32_t clockPclk1Hz(const ClockProfile &profile) {
+  return profile.ppre1 == RCC_CFGR_PPRE1_DIV2 ? profile.hz / 2 : profile.hz;
+}
+
+// A USART needs at least 16 clocks per bit, and the rounded divider within 2%
+constexpr bool clockUsartFits(uint32_t pclkHz, uint32_t baud) {
+  return pclkHz >= 16 * baud &&
+         (pclkHz + baud / 2) / baud * baud * 50 >= pclkHz * 49 && (pclkHz + baud / 2) / baud * baud * 50 <= pclkHz * 51;
+}
+
+// The slowest profile whose bus clocks still carry these baud rates (0 for
+// an unused USART)
+constexpr uint8_t clockLowestProfile(uint32_t apb1Baud, uint32_t apb2Baud, uint8_t profile = CLOCK_PROFILES - 1) {
+  return profile == 0 || ((apb1Baud == 0 || clockUsartFits(clockProfiles[profile].hz, apb1Baud)) &&
+                          (apb2Baud == 0 || clockUsartFits(clockProfiles[profile].hz, apb2Baud)))
+             ? profile
+             : clockLowestProfile(apb1Baud, apb2Baud, profile - 1);
+}
+
+// Runs with interrupts off, right after the clocks changed
+typedef void (*ClockListener)();
+
+class ClockScaler {
+public:
+  // The boot clock must be CLOCK_72MHZ's, HSE x 9; scaling stays off
+  // otherwise. Profiles slower than lowest are never picked.
+  void begin(ClockListener listener, uint8_t lowest = CLOCK_PROFILES - 1);
+  bool enabled() const { return _enabled; }
+
+  // Switches now. No peripheral clocked from the buses may be mid-transfer.
+  void select(uint8_t profile);
+  uint8_t profile() const { return _profile; }
+  uint32_t hz() const { return clockProfiles[_profile].hz; }
+
+  // Where the loop would delay(): the time since the last call counts as
+  // busy, then it delays. Updates wanted() once per CLOCK_WINDOW_MS.
+  void idle(uint32_t ms);
+  uint8_t wanted() const { return _wanted; }
+  // Wants the top profile until the next window, e.g. on input. Safe to
+  // call from interrupts.
+  void boost() { _wanted = CLOCK_72MHZ; }
+
+  // Time and load per profile, with the current the datasheet gives for it
+  // and the average those typicals add up to. An estimate: the board has
+  // no current sense.
+  void report(Print &out);
+
+private:
+  void apply(const ClockProfile &to);
+  void decide(uint32_t loadPercent);
+  void account();
+
+  ClockListener _listener = nullptr;
+  bool _enabled = false;
+  uint8_t _lowest = CLOCK_PROFILES - 1;
+  uint8_t _profile = CLOCK_72MHZ;
+  volatile uint8_t _wanted = CLOCK_72MHZ;
+
+  uint32_t _awakeUs = 0;
+  uint32_t _busyUs = 0;
+  uint32_t _idleUs = 0;
+
+  uint32_t _sinceMs = 0;
+  uint32_t _residencyMs[CLOCK_PROFILES] = {};
+  uint32_t _busyMs[CLOCK_PROFILES] = {};
+  uint32_t _switches = 0;
+};
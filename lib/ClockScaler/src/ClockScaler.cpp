@@ -0,0 +1,180 @@
+#include "ClockScaler.h"
+
+// SysTick counts left in the millisecond before it is rescaled; fewer and
+// it could wrap between reading and rewriting the counter
+#define CLOCK_TICK_MARGIN 1024
+
+class IrqLock {
+public:
+  IrqLock() : _primask(__get_PRIMASK()) { __disable_irq(); }
+  ~IrqLock() { __set_PRIMASK(_primask); }
+
+private:
+  uint32_t _primask;
+};
+
+static uint8_t pllMultiplier() {
+  return ((RCC->CFGR & RCC_CFGR_PLLMULL) >> RCC_CFGR_PLLMULL_Pos) + 2;
+}
+
+static void setLatency(uint8_t latency) {
+  FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY) | latency;
+}
+
+// The rest of the millisecond in progress, oldMhz counts per us, becomes
+// the same time at the new rate. The reload goes back to a full
+// millisecond as soon as the short one has been loaded, which leaves
+// micros()' fraction (LOAD - VAL) / LOAD continuous.
+static void rescaleSysTick(uint32_t oldMhz) {
+  uint32_t mhz = SystemCoreClock / 1000000;
+  while (SysTick->VAL < CLOCK_TICK_MARGIN) {
+  }
+  uint32_t left = SysTick->VAL * mhz / oldMhz;
+  SysTick->LOAD = left - 1;
+  SysTick->VAL = 0;
+  while (SysTick->VAL == 0) {
+  }
+  SysTick->LOAD = mhz * 1000 - 1;
+}
+
+void ClockScaler::begin(ClockListener listener, uint8_t lowest) {
+  _listener = listener;
+  _lowest = lowest < CLOCK_PROFILES ? lowest : CLOCK_PROFILES - 1;
+  bool fromHse = (RCC->CFGR & RCC_CFGR_PLLSRC) && !(RCC->CFGR & RCC_CFGR_PLLXTPRE) && HSE_VALUE == 8000000;
+  _enabled = fromHse && SystemCoreClock == clockProfiles[CLOCK_72MHZ].hz && pllMultiplier() == 9;
+  _profile = _wanted = CLOCK_72MHZ;
+  _sinceMs = millis();
+  _awakeUs = micros();
+}
+
+void ClockScaler::apply(const ClockProfile &to) {
+  if (to.latency > (FLASH->ACR & FLASH_ACR_LATENCY))
+    setLatency(to.latency);
+  uint32_t oldMhz = SystemCoreClock / 1000000;
+
+  // A larger APB1 divider before the AHB clock rises, a smaller one after
+  // it fell, so PCLK1 never passes 36 MHz
+  uint32_t cfgr = RCC->CFGR;
+  if (to.ppre1 > (cfgr & RCC_CFGR_PPRE1))
+    cfgr = (cfgr & ~RCC_CFGR_PPRE1) | to.ppre1;
+  RCC->CFGR = cfgr;
+  uint32_t source = to.pllMul ? RCC_CFGR_SW_PLL : RCC_CFGR_SW_HSE;
+  RCC->CFGR = (cfgr & ~(RCC_CFGR_HPRE | RCC_CFGR_SW)) | to.hpre | source;
+  while ((RCC->CFGR & RCC_CFGR_SWS) != source << 2) {
+  }
+  RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PPRE1) | to.ppre1;
+
+  if (to.latency < (FLASH->ACR & FLASH_ACR_LATENCY))
+    setLatency(to.latency);
+  SystemCoreClockUpdate();
+  rescaleSysTick(oldMhz);
+  if (_listener)
+    _listener();
+}
+
+void ClockScaler::select(uint8_t profile) {
+  if (!_enabled || profile == _profile || profile >= CLOCK_PROFILES)
+    return;
+  account();
+  const ClockProfile &to = clockProfiles[profile];
+  {
+    IrqLock lock;
+    bool pllOn = RCC->CR & RCC_CR_PLLON;
+    if (to.pllMul != 0 && (!pllOn || pllMultiplier() != to.pllMul)) {
+      if (clockProfiles[_profile].pllMul != 0)
+        apply(clockProfiles[CLOCK_8MHZ]);
+      RCC->CR &= ~RCC_CR_PLLON;
+      while (RCC->CR & RCC_CR_PLLRDY) {
+      }
+      RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PLLMULL) | ((uint32_t)(to.pllMul - 2) << RCC_CFGR_PLLMULL_Pos);
+      RCC->CR |= RCC_CR_PLLON;
+      while (!(RCC->CR & RCC_CR_PLLRDY)) {
+      }
+    }
+    apply(to);
+    // Saves the PLL's own current while it is not needed
+    if (to.pllMul == 0)
+      RCC->CR &= ~RCC_CR_PLLON;
+  }
+  _profile = profile;
+  _switches++;
+  // A fresh window at the new clock
+  _busyUs = _idleUs = 0;
+  _awakeUs = micros();
+}
+
+void ClockScaler::idle(uint32_t ms) {
+  uint32_t now = micros();
+  _busyUs += now - _awakeUs;
+  delay(ms);
+  _awakeUs = micros();
+  _idleUs += _awakeUs - now;
+
+  uint32_t windowUs = _busyUs + _idleUs;
+  if (windowUs < CLOCK_WINDOW_MS * 1000UL)
+    return;
+  _busyMs[_profile] += _busyUs / 1000;
+  decide((uint64_t)_busyUs * 100 / windowUs);
+  _busyUs = _idleUs = 0;
+}
+
+void ClockScaler::decide(uint32_t loadPercent) {
+  if (!_enabled)
+    return;
+  // The same work at another profile's clock
+  uint32_t hz = clockProfiles[_profile].hz;
+  auto loadAt = [&](uint8_t profile) { return loadPercent * (hz / 1000000) / (clockProfiles[profile].hz / 1000000); };
+
+  uint8_t wanted = _profile;
+  if (loadPercent > CLOCK_LOAD_HIGH) {
+    wanted = CLOCK_72MHZ;
+    for (uint8_t p = _profile; p-- > 0;) {
+      if (loadAt(p) <= CLOCK_LOAD_TARGET) {
+        wanted = p;
+        break;
+      }
+    }
+  } else {
+    for (uint8_t p = _lowest; p > _profile; p--) {
+      if (loadAt(p) <= CLOCK_LOAD_TARGET) {
+        wanted = p;
+        break;
+      }
+    }
+  }
+  _wanted = wanted;
+}
+
+void ClockScaler::account() {
+  uint32_t now = millis();
+  _residencyMs[_profile] += now - _sinceMs;
+  _sinceMs = now;
+}
+
+void ClockScaler::report(Print &out) {
+  account();
+  uint32_t totalMs = 0;
+  uint64_t chargeMa10Ms = 0;
+  for (uint8_t p = 0; p < CLOCK_PROFILES; p++) {
+    totalMs += _residencyMs[p];
+    chargeMa10Ms += (uint64_t)_residencyMs[p] * clockProfiles[p].typicalMa10;
+  }
+  if (totalMs == 0)
+    return;
+
+  out.printf("clock: %s, %lu MHz now, %lu switches\n", _enabled ? "scaling" : "fixed",
+             (unsigned long)(clockProfiles[_profile].hz / 1000000), (unsigned long)_switches);
+  for (uint8_t p = 0; p < CLOCK_PROFILES; p++) {
+    const ClockProfile &profile = clockProfiles[p];
+    uint32_t ms = _residencyMs[p];
+    out.printf("clock: %2lu MHz %3lu%% of the time, %3lu%% load, %2u.%u mA typ.%s\n",
+               (unsigned long)(profile.hz / 1000000), (unsigned long)((uint64_t)ms * 100 / totalMs),
+               (unsigned long)(ms ? (uint64_t)_busyMs[p] * 100 / ms : 0), profile.typicalMa10 / 10,
+               profile.typicalMa10 % 10, p > _lowest ? " (not used)" : "");
+  }
+  // Nothing here measures current: the datasheet typicals weighted by the
+  // time at each profile, an estimate of the MCU's share only
+  uint32_t averageMa10 = chargeMa10Ms / totalMs;
+  out.printf("clock: ~%lu.%lu mA MCU average, estimated from datasheet typicals, not measured\n",
+             (unsigned long)(averageMa10 / 10), (unsigned long)(averageMa10 % 10));
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+
+// Shared I2C bus scheduler.
+//
+// Every device on the bus gets its own transaction queue. The bus runs one
+// transaction at a time in interrupt mode and, when it finishes, picks the
+// next one across all queues by deadline (earliest first) and priority (ties).
+// Each device declares the fastest clock it accepts and the bus switches
+// between them per transaction, so the SH1106 runs in Fast-mode while the
+// PCF8574 stays within its 100 kHz rating.
+//
+// Blocking Wire users (u8g2 init, address scans) must call drain() first.
+
+#define I2C_BUS_QUEUE_DEPTH 8
+#define I2C_BUS_MAX_DEVICES 4
+#define I2C_BUS_HEADER_SIZE 8
+#define I2C_BUS_MAX_PAYLOAD 132
+
+struct I2CTransaction {
+  // Optional bytes sent before the payload (command/control bytes)
+  uint8_t header[I2C_BUS_HEADER_SIZE];
+  uint8_t headerLength = 0;
+
+  // Must stay valid until the transaction has completed
+  const uint8_t *payload = nullptr;
+  uint16_t payloadLength = 0;
+
+  // micros() by which the transaction should have started
+  uint32_t deadlineUs = 0;
+
+  // Time the device needs after this transaction before it accepts the next
+  uint16_t holdOffUs = 0;
+
+  uint32_t submittedUs = 0; // set by I2CDevice::submit()
+};
+
+struct I2CDeviceStats {
+  uint32_t transactions = 0;
+  uint32_t bytes = 0;
+  uint32_t errors = 0;
+  uint32_t deadlineMisses = 0;
+  uint32_t totalWaitUs = 0; // submit to start
+  uint32_t maxWaitUs = 0;
+};
+
+class I2CBus;
+
+// Told about every finished transaction, usually from the transfer-complete
+// interrupt
+typedef void (*I2CTransferObserver)(uint8_t address, uint16_t bytes, uint32_t waitUs, uint32_t transferUs);
+
+class I2CDevice {
+public:
+  // Higher priority wins when deadlines are equal
+  I2CDevice(uint8_t address, uint32_t maxClockHz, uint8_t priority);
+
+  // Queues a copy of the descriptor. Returns false if the queue is full.
+  bool submit(const I2CTransaction &transaction);
+
+  // Transactions queued or in flight
+  uint8_t pending() const { return _count; }
+  // Transactions whose payload the bus has not copied yet
+  uint8_t waiting() const;
+  bool idle() const { return _count == 0; }
+  bool full() const { return _count >= I2C_BUS_QUEUE_DEPTH; }
+
+  // True once if a transaction failed (NACK, arbitration lost) since the last call
+  bool takeError();
+
+  uint8_t address() const { return _address; }
+  uint32_t maxClockHz() const { return _maxClockHz; }
+  const I2CDeviceStats &stats() const { return _stats; }
+
+private:
+  friend class I2CBus;
+
+  I2CTransaction &head() { return _queue[_head]; }
+  void pop();
+
+  I2CBus *_bus = nullptr;
+  uint8_t _address;
+  uint32_t _maxClockHz;
+  uint8_t _priority;
+
+  I2CTransaction _queue[I2C_BUS_QUEUE_DEPTH];
+  volatile uint8_t _head = 0;
+  volatile uint8_t _count = 0;
+  uint32_t _holdOffStart = 0;
+  uint16_t _holdOffUs = 0;
+  volatile bool _error = false;
+
+  I2CDeviceStats _stats;
+};
+
+class I2CBus {
+public:
+  // Call after wire.begin()
+  void begin(TwoWire &wire = Wire);
+  void attach(I2CDevice &device);
+
+  // Completes the transaction in flight and starts the next one. Also runs
+  // from the transfer-complete interrupt, polling is only needed to pick up
+  // errors and devices coming out of a hold-off.
+  void service();
+
+  // Blocks until every queue is empty, after which Wire may be used directly
+  void drain();
+  // Call after the APB1 clock changed, with no transaction in flight: the
+  // next one sets its SCL rate again. The rate in use is kept for the
+  // utilization accounting.
+  void clockChanged() { _clockSet = false; }
+  bool idle() const;
+  // While held the bus finishes the transaction in flight but starts no
+  // other, e.g. to clear it for a clock switch; releasing starts the next
+  void hold(bool held);
+
+  TwoWire &wire() { return *_wire; }
+  const I2CDevice *active() const { return _active; }
+
+  // Share of time the bus spent transmitting since the last resetStats()
+  uint8_t utilizationPercent() const;
+  void resetStats();
+  void printStats(Print &out) const;
+  void setObserver(I2CTransferObserver observer) { _observer = observer; }
+
+  // Registered as the handle's master TX complete callback when the HAL is
+  // built with USE_HAL_I2C_REGISTER_CALLBACKS, otherwise service() polls
+  static void onTransferComplete(I2C_HandleTypeDef *handle);
+
+private:
+  void serviceLocked();
+  I2CDevice *pick(uint32_t now);
+  void setClock(uint32_t clockHz);
+
+  static I2CBus *_instance;
+
+  TwoWire *_wire = nullptr;
+  I2CDevice *_devices[I2C_BUS_MAX_DEVICES];
+  uint8_t _deviceCount = 0;
+  I2CDevice *volatile _active = nullptr;
+  uint16_t _activeLength = 0;
+  uint32_t _activeStartUs = 0;
+  uint32_t _activeWaitUs = 0;
+  I2CTransferObserver _observer = nullptr;
+  volatile bool _held = false;
+  uint32_t _clockHz = 0; // SCL rate of the last transaction
+  bool _clockSet = false; // whether Wire still runs at it
+
+  uint8_t _staging[I2C_BUS_HEADER_SIZE + I2C_BUS_MAX_PAYLOAD];
+
+  uint32_t _busyUs = 0;
+  uint32_t _windowStartUs = 0;
+};
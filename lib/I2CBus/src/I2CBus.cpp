@@ -0,0 +1,234 @@
+#include "I2CBus.h"
+
+I2CBus *I2CBus::_instance = nullptr;
+
+// Keeps the ISR and the main loop from touching the queues at the same time
+class BusLock {
+public:
+  BusLock() : _primask(__get_PRIMASK()) { __disable_irq(); }
+  ~BusLock() { __set_PRIMASK(_primask); }
+
+private:
+  uint32_t _primask;
+};
+
+// Address byte + payload, 9 clocks per byte, plus start and stop
+static uint32_t wireTimeUs(uint16_t length, uint32_t clockHz) {
+  if (clockHz == 0)
+    return 0;
+  uint32_t bits = (uint32_t)(length + 1) * 9 + 2;
+  return (bits * 1000000UL) / clockHz;
+}
+
+I2CDevice::I2CDevice(uint8_t address, uint32_t maxClockHz, uint8_t priority)
+    : _address(address), _maxClockHz(maxClockHz), _priority(priority) {}
+
+bool I2CDevice::submit(const I2CTransaction &transaction) {
+  {
+    BusLock lock;
+    if (_count >= I2C_BUS_QUEUE_DEPTH)
+      return false;
+
+    I2CTransaction &slot = _queue[(_head + _count) % I2C_BUS_QUEUE_DEPTH];
+    slot = transaction;
+    slot.submittedUs = micros();
+    _count++;
+  }
+
+  if (_bus)
+    _bus->service();
+  return true;
+}
+
+uint8_t I2CDevice::waiting() const {
+  BusLock lock;
+  return _count - ((_bus && _bus->active() == this) ? 1 : 0);
+}
+
+bool I2CDevice::takeError() {
+  BusLock lock;
+  bool error = _error;
+  _error = false;
+  return error;
+}
+
+void I2CDevice::pop() {
+  _holdOffStart = micros();
+  _holdOffUs = _queue[_head].holdOffUs;
+  _head = (_head + 1) % I2C_BUS_QUEUE_DEPTH;
+  _count--;
+}
+
+void I2CBus::begin(TwoWire &wire) {
+  _wire = &wire;
+  _instance = this;
+  resetStats();
+
+#if USE_HAL_I2C_REGISTER_CALLBACKS
+  // Registered on Wire's own handle rather than by overriding the weak
+  // global hook, which the core's twi.c is free to define itself
+  HAL_I2C_RegisterCallback(wire.getHandle(), HAL_I2C_MASTER_TX_COMPLETE_CB_ID, onTransferComplete);
+#endif
+}
+
+void I2CBus::attach(I2CDevice &device) {
+  if (_deviceCount >= I2C_BUS_MAX_DEVICES || device._bus == this)
+    return;
+  device._bus = this;
+  _devices[_deviceCount++] = &device;
+}
+
+void I2CBus::service() {
+  if (_wire == nullptr)
+    return;
+  BusLock lock;
+  serviceLocked();
+}
+
+void I2CBus::hold(bool held) {
+  _held = held;
+  if (!held)
+    service();
+}
+
+void I2CBus::onTransferComplete(I2C_HandleTypeDef *handle) {
+  if (_instance && _instance->_wire && handle == _instance->_wire->getHandle())
+    _instance->serviceLocked();
+}
+
+void I2CBus::serviceLocked() {
+  I2C_HandleTypeDef *handle = _wire->getHandle();
+  uint32_t now = micros();
+
+  if (_active) {
+    if (HAL_I2C_GetState(handle) != HAL_I2C_STATE_READY)
+      return;
+
+    I2CDevice *device = _active;
+    if (HAL_I2C_GetError(handle) != HAL_I2C_ERROR_NONE) {
+      device->_stats.errors++;
+      device->_error = true;
+    }
+    _busyUs += wireTimeUs(_activeLength, _clockHz);
+    if (_observer)
+      _observer(device->_address, _activeLength, _activeWaitUs, now - _activeStartUs);
+    device->pop();
+    _active = nullptr;
+  }
+
+  if (_held)
+    return;
+  I2CDevice *device = pick(now);
+  if (device == nullptr)
+    return;
+
+  I2CTransaction &transaction = device->head();
+  uint16_t length = transaction.headerLength + transaction.payloadLength;
+  if (transaction.headerLength > I2C_BUS_HEADER_SIZE || transaction.payloadLength > I2C_BUS_MAX_PAYLOAD) {
+    device->_stats.errors++;
+    device->_error = true;
+    device->pop();
+    return;
+  }
+
+  // HAL interrupt transfers need one contiguous buffer
+  memcpy(_staging, transaction.header, transaction.headerLength);
+  if (transaction.payloadLength)
+    memcpy(_staging + transaction.headerLength, transaction.payload, transaction.payloadLength);
+
+  setClock(device->_maxClockHz);
+
+  // HAL_BUSY means a blocking Wire user is on the bus, retry on the next poll
+  if (HAL_I2C_Master_Transmit_IT(handle, device->_address << 1, _staging, length) != HAL_OK)
+    return;
+
+  uint32_t waitUs = now - transaction.submittedUs;
+  _active = device;
+  _activeLength = length;
+  _activeStartUs = now;
+  _activeWaitUs = waitUs;
+
+  I2CDeviceStats &stats = device->_stats;
+  stats.transactions++;
+  stats.bytes += length;
+  stats.totalWaitUs += waitUs;
+  if (waitUs > stats.maxWaitUs)
+    stats.maxWaitUs = waitUs;
+  if ((int32_t)(now - transaction.deadlineUs) > 0)
+    stats.deadlineMisses++;
+}
+
+I2CDevice *I2CBus::pick(uint32_t now) {
+  I2CDevice *best = nullptr;
+  int32_t bestSlack = 0;
+
+  for (uint8_t i = 0; i < _deviceCount; i++) {
+    I2CDevice *device = _devices[i];
+    if (device->_count == 0)
+      continue;
+    if ((now - device->_holdOffStart) < device->_holdOffUs)
+      continue;
+
+    int32_t slack = (int32_t)(device->head().deadlineUs - now);
+    if (best == nullptr || slack < bestSlack ||
+        (slack == bestSlack && device->_priority > best->_priority)) {
+      best = device;
+      bestSlack = slack;
+    }
+  }
+
+  return best;
+}
+
+void I2CBus::setClock(uint32_t clockHz) {
+  if (clockHz == _clockHz && _clockSet)
+    return;
+  // Reprograms CCR/TRISE with the peripheral briefly disabled, a few us
+  _wire->setClock(clockHz);
+  _clockHz = clockHz;
+  _clockSet = true;
+}
+
+void I2CBus::drain() {
+  while (!idle())
+    service();
+
+  // The caller is about to use Wire directly and may change its clock
+  _clockSet = false;
+}
+
+bool I2CBus::idle() const {
+  if (_active)
+    return false;
+  for (uint8_t i = 0; i < _deviceCount; i++)
+    if (_devices[i]->_count != 0)
+      return false;
+  return true;
+}
+
+uint8_t I2CBus::utilizationPercent() const {
+  uint32_t windowUs = micros() - _windowStartUs;
+  if (windowUs == 0)
+    return 0;
+  return min((uint32_t)100, (uint32_t)(((uint64_t)_busyUs * 100) / windowUs));
+}
+
+void I2CBus::resetStats() {
+  BusLock lock;
+  _busyUs = 0;
+  _windowStartUs = micros();
+  for (uint8_t i = 0; i < _deviceCount; i++)
+    _devices[i]->_stats = I2CDeviceStats();
+}
+
+void I2CBus::printStats(Print &out) const {
+  out.printf("i2c %u%% busy\n", utilizationPercent());
+  for (uint8_t i = 0; i < _deviceCount; i++) {
+    const I2CDevice &device = *_devices[i];
+    const I2CDeviceStats &stats = device._stats;
+    uint32_t avgWaitUs = stats.transactions ? stats.totalWaitUs / stats.transactions : 0;
+    out.printf(" 0x%02X @%lukHz: %lu tx %lu B, wait avg %lu max %lu us, %lu late, %lu err\n",
+               device._address, device._maxClockHz / 1000, stats.transactions, stats.bytes,
+               avgWaitUs, stats.maxWaitUs, stats.deadlineMisses, stats.errors);
+  }
+}
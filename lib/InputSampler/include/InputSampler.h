@@ -0,0 +1,75 @@
+#pragma once
+#include <Arduino.h>
+
+// Controls sampled at 1 kHz from a TIM3 interrupt, so an input is seen within
+// a millisecond no matter what the main loop is blocked on.
+//
+// The joystick axes are converted on ADC2 by register, one axis per tick:
+// each tick reads the previous conversion and starts the next, so the
+// interrupt never waits on the ADC. analogRead() keeps ADC1 to itself.
+//
+// The button acts on its first low sample and re-arms after it has read
+// high for INPUT_RELEASE_MS. An axis fires when its direction changes, and
+// again every INPUT_REPEAT_MS while held.
+//
+// Each event is latched for the main loop with the time it was sampled, and
+// passed to the handler from inside the interrupt, which is where anything
+// that has to be heard at once should happen.
+
+#define INPUT_SAMPLE_HZ 1000
+#define INPUT_RELEASE_MS 50
+#define INPUT_COOLDOWN_MS 200 // between button presses
+#define INPUT_REPEAT_MS 1500  // while an axis is held
+#define INPUT_AXIS_HIGH 950   // 10-bit, like analogRead()
+#define INPUT_AXIS_LOW 250
+
+enum InputKind : uint8_t {
+  INPUT_SKIP,  // -1 or 1
+  INPUT_SPEED, // -1 or 1
+  INPUT_PAUSE, // 1
+  INPUT_KINDS,
+};
+
+typedef void (*InputHandler)(InputKind kind, int8_t value, uint32_t timeUs);
+
+class InputSampler {
+public:
+  // skipChannel and speedChannel are ADC12_IN numbers (PA0..PA7 are 0..7);
+  // the button pin needs its pull-up set already
+  void begin(uint32_t buttonPin, uint8_t skipChannel, uint8_t speedChannel);
+  void setHandler(InputHandler handler) { _handler = handler; }
+  // Call after the APB1 clock changed, keeps the sample rate
+  void clockChanged();
+
+  // The latched event of this kind, or 0; timeUs is when it was sampled
+  int8_t take(InputKind kind, uint32_t *timeUs = nullptr);
+
+  // Last reading, 10-bit
+  uint16_t axis(InputKind kind) const { return _axisValue[kind]; }
+
+  // Called by the timer interrupt
+  void sample();
+
+private:
+  struct Axis {
+    uint8_t channel;
+    int8_t direction;
+    uint32_t lastFireMs;
+  };
+
+  void event(InputKind kind, int8_t value, uint32_t nowUs);
+  void sampleAxis(InputKind kind, uint16_t value, uint32_t nowMs, uint32_t nowUs);
+
+  PinName _buttonPin = NC;
+  bool _buttonArmed = true;
+  uint32_t _buttonHighSinceMs = 0;
+  uint32_t _buttonPressMs = 0;
+
+  Axis _axes[2] = {};
+  uint8_t _converting = 0; // index into _axes
+  volatile uint16_t _axisValue[2] = {};
+
+  volatile int8_t _pending[INPUT_KINDS] = {};
+  volatile uint32_t _pendingUs[INPUT_KINDS] = {};
+  InputHandler _handler = nullptr;
+};
@@ -0,0 +1,130 @@
+#include "InputSampler.h"
+
+#define INPUT_ADC ADC2
+#define INPUT_TIMER TIM3
+
+// 239.5 cycles at 12 MHz, about 21 us (28 us at the line-in analyzer's
+// 9 MHz): plenty for the joystick's pots
+#define INPUT_ADC_SAMPLE_TIME 7
+
+static HardwareTimer inputTimer(INPUT_TIMER);
+static InputSampler *activeSampler = nullptr;
+
+static void onInputTimer() {
+  activeSampler->sample();
+}
+
+class IrqLock {
+public:
+  IrqLock() : _primask(__get_PRIMASK()) { __disable_irq(); }
+  ~IrqLock() { __set_PRIMASK(_primask); }
+
+private:
+  uint32_t _primask;
+};
+
+static void startConversion(uint8_t channel) {
+  INPUT_ADC->SQR3 = channel;
+  INPUT_ADC->CR2 |= ADC_CR2_SWSTART;
+}
+
+void InputSampler::begin(uint32_t buttonPin, uint8_t skipChannel, uint8_t speedChannel) {
+  _buttonPin = digitalPinToPinName(buttonPin);
+  _axes[INPUT_SKIP].channel = skipChannel;
+  _axes[INPUT_SPEED].channel = speedChannel;
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_ADC2_CLK_ENABLE();
+  // The ADC clock must stay under 14 MHz; the core picks the same for ADC1
+  __HAL_RCC_ADC_CONFIG(RCC_ADCPCLK2_DIV6);
+
+  GPIO_InitTypeDef pins = {};
+  pins.Pin = (1 << skipChannel) | (1 << speedChannel);
+  pins.Mode = GPIO_MODE_ANALOG;
+  HAL_GPIO_Init(GPIOA, &pins);
+
+  INPUT_ADC->CR1 = 0;
+  INPUT_ADC->SMPR2 = (INPUT_ADC_SAMPLE_TIME << (3 * skipChannel)) | (INPUT_ADC_SAMPLE_TIME << (3 * speedChannel));
+  INPUT_ADC->SQR1 = 0; // one conversion per start
+  INPUT_ADC->CR2 = ADC_CR2_ADON;
+  delayMicroseconds(2);
+  INPUT_ADC->CR2 |= ADC_CR2_CAL;
+  while (INPUT_ADC->CR2 & ADC_CR2_CAL) {
+  }
+  // Software trigger (EXTSEL = SWSTART)
+  INPUT_ADC->CR2 = ADC_CR2_ADON | ADC_CR2_EXTTRIG | ADC_CR2_EXTSEL;
+  _converting = INPUT_SKIP;
+  startConversion(_axes[_converting].channel);
+
+  _buttonHighSinceMs = _buttonPressMs = millis();
+  activeSampler = this;
+  inputTimer.setOverflow(INPUT_SAMPLE_HZ, HERTZ_FORMAT);
+  inputTimer.attachInterrupt(onInputTimer);
+  inputTimer.resume();
+}
+
+void InputSampler::clockChanged() {
+  // From the next period on; the ADC's clock just slows with APB2
+  inputTimer.setOverflow(INPUT_SAMPLE_HZ, HERTZ_FORMAT);
+}
+
+int8_t InputSampler::take(InputKind kind, uint32_t *timeUs) {
+  IrqLock lock;
+  int8_t value = _pending[kind];
+  _pending[kind] = 0;
+  if (timeUs != nullptr)
+    *timeUs = _pendingUs[kind];
+  return value;
+}
+
+void InputSampler::event(InputKind kind, int8_t value, uint32_t nowUs) {
+  _pending[kind] = value;
+  _pendingUs[kind] = nowUs;
+  if (_handler != nullptr)
+    _handler(kind, value, nowUs);
+}
+
+void InputSampler::sampleAxis(InputKind kind, uint16_t value, uint32_t nowMs, uint32_t nowUs) {
+  Axis &axis = _axes[kind];
+  _axisValue[kind] = value;
+
+  int8_t direction = 0;
+  if (value > INPUT_AXIS_HIGH)
+    direction = 1;
+  else if (value < INPUT_AXIS_LOW)
+    direction = -1;
+
+  if (direction != axis.direction || nowMs - axis.lastFireMs >= INPUT_REPEAT_MS) {
+    axis.lastFireMs = nowMs;
+    if (direction != 0)
+      event(kind, direction, nowUs);
+  }
+  axis.direction = direction;
+}
+
+void InputSampler::sample() {
+  uint32_t nowUs = micros();
+  uint32_t nowMs = millis();
+
+  if (digitalReadFast(_buttonPin) == LOW) {
+    if (_buttonArmed && nowMs - _buttonPressMs > INPUT_COOLDOWN_MS) {
+      _buttonArmed = false;
+      _buttonPressMs = nowMs;
+      event(INPUT_PAUSE, 1, nowUs);
+    }
+    _buttonHighSinceMs = nowMs;
+  } else if (nowMs - _buttonHighSinceMs > INPUT_RELEASE_MS) {
+    _buttonArmed = true;
+  }
+
+  // The conversion started a tick ago has long finished
+  if (INPUT_ADC->SR & ADC_SR_EOC) {
+    uint8_t converted = _converting;
+    uint16_t value = INPUT_ADC->DR >> 2;
+    _converting = converted == INPUT_SKIP ? INPUT_SPEED : INPUT_SKIP;
+    startConversion(_axes[_converting].channel);
+    sampleAxis((InputKind)converted, value, nowMs, nowUs);
+  } else {
+    startConversion(_axes[_converting].channel);
+  }
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <Arduino.h>
+#include <I2CBus.h>
+
+// HD44780 1602 LCD behind a PCF8574 I2C backpack.
+//
+// Unlike LiquidCrystal_I2C, which sends every nibble as its own blocking Wire
+// transmission, this driver encodes whole command/character sequences into a
+// single burst and queues it on the shared I2CBus. A full-row update is one
+// bus transaction and the caller never waits on it.
+//
+// The device is registered at the PCF8574's standard-mode (100 kHz) limit:
+// every byte then takes ~90us on the wire, which already covers the 37us
+// HD44780 execution time between characters, so no delays have to be
+// inserted inside a burst.
+
+#define LCD_PCF8574_BURST_SIZE 80 // setCursor + 16 chars, 4 bytes each, plus RS setup bytes
+#define LCD_PCF8574_QUEUE_DEPTH 4 // must not exceed I2C_BUS_QUEUE_DEPTH
+#define LCD_PCF8574_CLOCK_HZ 100000
+#define LCD_PCF8574_PRIORITY 0
+#define LCD_PCF8574_DEADLINE_US 100000 // text may lag a few OLED frames
+#define LCD_PCF8574_MAX_COLS 16
+#define LCD_PCF8574_MAX_ROWS 2
+
+class LiquidCrystal_PCF8574 : public Print {
+public:
+  LiquidCrystal_PCF8574(I2CBus &bus, uint8_t address, uint8_t cols = 16, uint8_t rows = 2);
+
+  // Blocking HD44780 power-on sequence, call once after bus.begin()
+  void begin();
+
+  // Same sequence without blocking: it is queued on the bus step by step from
+  // service(), using device hold-offs for the datasheet waits. Until ready(),
+  // printRow() returns false and the other calls block.
+  void beginAsync();
+  bool ready() const { return _initStep == INIT_DONE; }
+
+  void clear();
+  void home();
+  void setCursor(uint8_t col, uint8_t row);
+  void backlight();
+  void noBacklight();
+
+  // Appends to the open burst; committed by commit() or when the burst fills up
+  size_t write(uint8_t value) override;
+  using Print::write;
+
+  // Queues the open burst for transmission
+  void commit();
+
+  // Updates a row (padded with spaces) as one burst that only rewrites the
+  // cells whose character changed since the last update, so unchanged rows
+  // cost nothing. Returns false if the queue was full, in which case the
+  // caller should retry on the next frame.
+  bool printRow(uint8_t row, const char *text);
+
+  // Loads 5x8 glyph slot 0-7 into CGRAM (one byte per pixel row, low 5 bits),
+  // shown as character slot or slot + 8; use the latter in printRow() text.
+  // Unchanged glyphs cost nothing, otherwise returns false like printRow().
+  // Leaves the address counter in CGRAM: setCursor() before any write().
+  bool defineChar(uint8_t slot, const uint8_t *pixels);
+
+  // Polls the bus for completion and errors. Call often, e.g. once per UI frame.
+  void service();
+
+  // True when nothing is queued or in flight
+  bool idle() const;
+
+  uint8_t address() const { return _device.address(); }
+
+private:
+  struct Burst {
+    uint8_t data[LCD_PCF8574_BURST_SIZE];
+    uint8_t length;
+    uint16_t holdOffUs; // settle time required after this burst (clear/home)
+  };
+
+  void command(uint8_t value, uint16_t holdOffUs = 0);
+  void send(uint8_t value, uint8_t mode);
+  void encodeNibble(Burst &burst, uint8_t nibble, uint8_t mode);
+  Burst &openBurst(size_t bytesNeeded);
+  uint8_t busyBursts() const;
+  void waitForSlot();
+  void waitUntilReady();
+  void submitInitStep(uint8_t step);
+
+  I2CBus &_bus;
+  I2CDevice _device;
+  uint8_t _cols;
+  uint8_t _rows;
+  uint8_t _backlight;
+  uint8_t _lastMode = 0xFF; // RS level of the last byte put on the expander
+
+  // Bursts are submitted in order and the bus completes them in order, so the
+  // oldest _device.pending() slots before _tail are still in use
+  Burst _queue[LCD_PCF8574_QUEUE_DEPTH];
+  uint8_t _tail = 0;  // next burst to fill
+  bool _open = false; // _queue[_tail] is being filled
+
+  static const uint8_t INIT_DONE = 5;
+  uint8_t _initStep = INIT_DONE;
+
+  char _shadow[LCD_PCF8574_MAX_ROWS][LCD_PCF8574_MAX_COLS]; // last text sent per row, for printRow()
+  uint8_t _glyphs[8][8];  // last pixels sent per CGRAM slot, for defineChar()
+  uint8_t _glyphsKnown = 0; // bit per slot whose _glyphs match the controller
+};
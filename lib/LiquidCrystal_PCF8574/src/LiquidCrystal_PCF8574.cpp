@@ -0,0 +1,290 @@
+#include "LiquidCrystal_PCF8574.h"
+
+// PCF8574 pin mapping used by the common 1602 backpacks
+#define PIN_RS 0x01
+#define PIN_EN 0x04
+#define PIN_BACKLIGHT 0x08
+
+// HD44780 instructions
+#define LCD_CLEARDISPLAY 0x01
+#define LCD_RETURNHOME 0x02
+#define LCD_ENTRYMODESET 0x04
+#define LCD_DISPLAYCONTROL 0x08
+#define LCD_FUNCTIONSET 0x20
+#define LCD_SETCGRAMADDR 0x40
+#define LCD_SETDDRAMADDR 0x80
+
+#define LCD_ENTRYLEFT 0x02
+#define LCD_DISPLAYON 0x04
+#define LCD_4BITMODE 0x00
+#define LCD_2LINE 0x08
+#define LCD_5x8DOTS 0x00
+
+// clear and home take 1.52ms, round up for slow controllers
+#define LCD_CLEAR_HOLDOFF_US 2000
+
+LiquidCrystal_PCF8574::LiquidCrystal_PCF8574(I2CBus &bus, uint8_t address, uint8_t cols, uint8_t rows)
+    : _bus(bus),
+      _device(address, LCD_PCF8574_CLOCK_HZ, LCD_PCF8574_PRIORITY),
+      _cols(min(cols, (uint8_t)LCD_PCF8574_MAX_COLS)),
+      _rows(min(rows, (uint8_t)LCD_PCF8574_MAX_ROWS)),
+      _backlight(PIN_BACKLIGHT) {
+  memset(_shadow, 0, sizeof(_shadow));
+}
+
+void LiquidCrystal_PCF8574::begin() {
+  beginAsync();
+  waitUntilReady();
+  while (!idle())
+    service();
+}
+
+void LiquidCrystal_PCF8574::beginAsync() {
+  _bus.attach(_device);
+  _initStep = 0;
+  _lastMode = 0xFF;
+  service();
+}
+
+void LiquidCrystal_PCF8574::waitUntilReady() {
+  while (!ready())
+    service();
+}
+
+void LiquidCrystal_PCF8574::submitInitStep(uint8_t step) {
+  // Reset into 4-bit mode (datasheet figure 24): single nibbles, each followed
+  // by the wait the controller needs before the next one
+  const uint8_t resetNibbles[] = {0x03, 0x03, 0x03, 0x02};
+  const uint16_t resetWaitsUs[] = {4500, 4500, 150, 150};
+
+  if (step < sizeof(resetNibbles)) {
+    uint8_t bits = (resetNibbles[step] << 4) | _backlight;
+    Burst &burst = openBurst(3);
+    burst.data[burst.length++] = _backlight;
+    burst.data[burst.length++] = bits | PIN_EN;
+    burst.data[burst.length++] = bits;
+    burst.holdOffUs = resetWaitsUs[step];
+    commit();
+    _lastMode = 0;
+    return;
+  }
+
+  command(LCD_FUNCTIONSET | LCD_4BITMODE | LCD_2LINE | LCD_5x8DOTS);
+  command(LCD_DISPLAYCONTROL | LCD_DISPLAYON);
+  command(LCD_ENTRYMODESET | LCD_ENTRYLEFT);
+  command(LCD_CLEARDISPLAY, LCD_CLEAR_HOLDOFF_US);
+  memset(_shadow, ' ', sizeof(_shadow));
+  _glyphsKnown = 0;
+}
+
+void LiquidCrystal_PCF8574::clear() {
+  waitUntilReady();
+  command(LCD_CLEARDISPLAY, LCD_CLEAR_HOLDOFF_US);
+  memset(_shadow, ' ', sizeof(_shadow));
+}
+
+void LiquidCrystal_PCF8574::home() {
+  waitUntilReady();
+  command(LCD_RETURNHOME, LCD_CLEAR_HOLDOFF_US);
+}
+
+void LiquidCrystal_PCF8574::setCursor(uint8_t col, uint8_t row) {
+  waitUntilReady();
+  const uint8_t rowOffsets[] = {0x00, 0x40, 0x14, 0x54};
+  if (row >= _rows)
+    row = _rows - 1;
+  command(LCD_SETDDRAMADDR | (col + rowOffsets[row]));
+}
+
+void LiquidCrystal_PCF8574::backlight() {
+  waitUntilReady();
+  _backlight = PIN_BACKLIGHT;
+  Burst &burst = openBurst(1);
+  burst.data[burst.length++] = _backlight;
+  // RS went low with it, the next nibble needs its setup byte again
+  _lastMode = 0;
+  commit();
+}
+
+void LiquidCrystal_PCF8574::noBacklight() {
+  waitUntilReady();
+  _backlight = 0;
+  Burst &burst = openBurst(1);
+  burst.data[burst.length++] = _backlight;
+  // RS went low with it, the next nibble needs its setup byte again
+  _lastMode = 0;
+  commit();
+}
+
+size_t LiquidCrystal_PCF8574::write(uint8_t value) {
+  waitUntilReady();
+  // Free-form writes can land anywhere, so printRow() has to resend
+  memset(_shadow, 0, sizeof(_shadow));
+  send(value, PIN_RS);
+  return 1;
+}
+
+void LiquidCrystal_PCF8574::command(uint8_t value, uint16_t holdOffUs) {
+  send(value, 0);
+  if (holdOffUs) {
+    // Nothing may follow in the same burst, the controller is busy
+    _queue[_tail].holdOffUs = holdOffUs;
+    commit();
+  }
+}
+
+void LiquidCrystal_PCF8574::send(uint8_t value, uint8_t mode) {
+  // Two nibbles of two bytes each, plus one setup byte if RS changes
+  Burst &burst = openBurst(5);
+  encodeNibble(burst, value >> 4, mode);
+  encodeNibble(burst, value & 0x0F, mode);
+}
+
+void LiquidCrystal_PCF8574::encodeNibble(Burst &burst, uint8_t nibble, uint8_t mode) {
+  uint8_t bits = (nibble << 4) | mode | _backlight;
+
+  // RS must be stable before EN rises
+  if (mode != _lastMode) {
+    burst.data[burst.length++] = bits;
+    _lastMode = mode;
+  }
+
+  // The controller latches on the falling edge of EN
+  burst.data[burst.length++] = bits | PIN_EN;
+  burst.data[burst.length++] = bits;
+}
+
+LiquidCrystal_PCF8574::Burst &LiquidCrystal_PCF8574::openBurst(size_t bytesNeeded) {
+  if (_open) {
+    Burst &burst = _queue[_tail];
+    if (burst.length + bytesNeeded <= LCD_PCF8574_BURST_SIZE)
+      return burst;
+    commit();
+  }
+
+  waitForSlot();
+
+  Burst &burst = _queue[_tail];
+  burst.length = 0;
+  burst.holdOffUs = 0;
+  _open = true;
+  return burst;
+}
+
+void LiquidCrystal_PCF8574::commit() {
+  if (!_open)
+    return;
+
+  _open = false;
+  Burst &burst = _queue[_tail];
+  if (burst.length == 0)
+    return;
+
+  I2CTransaction transaction;
+  transaction.payload = burst.data;
+  transaction.payloadLength = burst.length;
+  transaction.holdOffUs = burst.holdOffUs;
+  transaction.deadlineUs = micros() + LCD_PCF8574_DEADLINE_US;
+
+  // openBurst() made sure a slot is free, so this cannot fail
+  _device.submit(transaction);
+  _tail = (_tail + 1) % LCD_PCF8574_QUEUE_DEPTH;
+}
+
+uint8_t LiquidCrystal_PCF8574::busyBursts() const {
+  return _device.pending() + (_open ? 1 : 0);
+}
+
+void LiquidCrystal_PCF8574::waitForSlot() {
+  // Only reached when the caller produces bursts faster than the bus drains
+  // them; printRow() avoids it by checking for space first.
+  while (busyBursts() >= LCD_PCF8574_QUEUE_DEPTH)
+    service();
+}
+
+bool LiquidCrystal_PCF8574::printRow(uint8_t row, const char *text) {
+  if (!ready())
+    return false;
+  if (row >= _rows)
+    return true;
+
+  char line[LCD_PCF8574_MAX_COLS];
+  uint8_t i = 0;
+  for (; i < _cols && text[i] != '\0'; i++)
+    line[i] = text[i];
+  for (; i < _cols; i++)
+    line[i] = ' ';
+
+  if (memcmp(line, _shadow[row], _cols) == 0)
+    return true;
+
+  commit();
+  if (busyBursts() >= LCD_PCF8574_QUEUE_DEPTH)
+    return false;
+
+  // Runs of changed cells, each behind its own setCursor. A single unchanged
+  // cell between two runs is cheaper to resend (4 bytes) than to skip with a
+  // new setCursor (6 with the RS changes). Even the worst case, the whole
+  // row, fits one burst.
+  uint8_t col = 0;
+  while (col < _cols) {
+    if (line[col] == _shadow[row][col]) {
+      col++;
+      continue;
+    }
+    uint8_t end = col + 1;
+    while (end < _cols && (line[end] != _shadow[row][end] ||
+                           (end + 1 < _cols && line[end + 1] != _shadow[row][end + 1])))
+      end++;
+    setCursor(col, row);
+    for (; col < end; col++)
+      send(line[col], PIN_RS);
+  }
+  commit();
+
+  memcpy(_shadow[row], line, _cols);
+  return true;
+}
+
+bool LiquidCrystal_PCF8574::defineChar(uint8_t slot, const uint8_t *pixels) {
+  if (!ready())
+    return false;
+  slot &= 7;
+  if ((_glyphsKnown & (1 << slot)) && memcmp(pixels, _glyphs[slot], 8) == 0)
+    return true;
+
+  commit();
+  if (busyBursts() >= LCD_PCF8574_QUEUE_DEPTH)
+    return false;
+
+  // Address plus 8 rows, 38 bytes
+  command(LCD_SETCGRAMADDR | (slot << 3));
+  for (uint8_t i = 0; i < 8; i++)
+    send(pixels[i] & 0x1F, PIN_RS);
+  commit();
+
+  memcpy(_glyphs[slot], pixels, 8);
+  _glyphsKnown |= 1 << slot;
+  return true;
+}
+
+void LiquidCrystal_PCF8574::service() {
+  // HD44780 needs >40ms after Vcc rises before it accepts commands. The MCU
+  // comes up with it, so uptime is a good enough proxy.
+  while (_initStep < INIT_DONE && busyBursts() < LCD_PCF8574_QUEUE_DEPTH &&
+         (_initStep > 0 || millis() >= 50))
+    submitInitStep(_initStep++);
+
+  _bus.service();
+
+  // A failed burst leaves the display in an unknown state, resend rows
+  // and glyphs
+  if (_device.takeError()) {
+    memset(_shadow, 0, sizeof(_shadow));
+    _glyphsKnown = 0;
+  }
+}
+
+bool LiquidCrystal_PCF8574::idle() const {
+  return _device.idle() && !_open;
+}
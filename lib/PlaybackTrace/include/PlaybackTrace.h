@@ -0,0 +1,60 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Playback timeline trace: every note start and stop with a microsecond
+// timestamp, kept in a RAM ring that overwrites the oldest events.
+//
+// Runs unchanged in the firmware (TRACE in main.cpp) and in the host
+// simulator (tools/playsim.cpp). Both print it with dump() and
+// tools/tracecmp.py compares it against the ideal schedule of each song.
+// song() starts a new trace. Notes carry their index, so a long song whose
+// first notes were overwritten still lines up.
+
+#ifndef TRACE_CAPACITY
+#define TRACE_CAPACITY 256
+#endif
+
+enum TraceKind : uint8_t {
+  TRACE_SONG,   // note = song index, value = speed in 1/1000
+  TRACE_START,  // value = frequency, 0 for a rest
+  TRACE_STOP,
+  TRACE_ANCHOR, // schedule restarts here (pause, speed change), value = speed in 1/1000
+};
+
+struct TraceEvent {
+  uint32_t timeUs;
+  uint16_t note;
+  uint16_t value;
+  TraceKind kind;
+};
+
+typedef void (*TraceLineWriter)(const char *line);
+
+class PlaybackTrace {
+public:
+  // Speeds in per mille, as in SPEED_SETTINGS_PERMILLE
+  void song(uint32_t timeUs, uint16_t songIndex, uint16_t speedPermille);
+  void start(uint32_t timeUs, uint16_t note, uint16_t frequency);
+  void stop(uint32_t timeUs, uint16_t note);
+  void anchor(uint32_t timeUs, uint16_t note, uint16_t speedPermille);
+
+  // Events oldest first, not counting the song line
+  size_t count() const { return _count; }
+  const TraceEvent &at(size_t index) const { return _events[(_first + index) % TRACE_CAPACITY]; }
+  uint32_t overwritten() const { return _overwritten; }
+
+  // Song line, events oldest first, then "end <overwritten>"; lines have no
+  // newline. Does nothing before the first song().
+  void dump(TraceLineWriter write) const;
+
+private:
+  void push(uint32_t timeUs, TraceKind kind, uint16_t note, uint16_t value);
+
+  TraceEvent _song;
+  bool _started = false;
+  TraceEvent _events[TRACE_CAPACITY];
+  size_t _first = 0;
+  size_t _count = 0;
+  uint32_t _overwritten = 0;
+};
@@ -0,0 +1,70 @@
+#include "PlaybackTrace.h"
+#include <stdio.h>
+
+static int format(const TraceEvent &event, char *line, size_t size) {
+  unsigned long timeUs = event.timeUs;
+  switch (event.kind) {
+  case TRACE_SONG:
+    return snprintf(line, size, "song %lu %u %u", timeUs, event.note, event.value);
+  case TRACE_START:
+    return snprintf(line, size, "start %lu %u %u", timeUs, event.note, event.value);
+  case TRACE_STOP:
+    return snprintf(line, size, "stop %lu %u", timeUs, event.note);
+  case TRACE_ANCHOR:
+    return snprintf(line, size, "anchor %lu %u %u", timeUs, event.note, event.value);
+  }
+  return 0;
+}
+
+void PlaybackTrace::song(uint32_t timeUs, uint16_t songIndex, uint16_t speedPermille) {
+  _song.timeUs = timeUs;
+  _song.kind = TRACE_SONG;
+  _song.note = songIndex;
+  _song.value = speedPermille;
+  _started = true;
+  _first = 0;
+  _count = 0;
+  _overwritten = 0;
+}
+
+void PlaybackTrace::start(uint32_t timeUs, uint16_t note, uint16_t frequency) {
+  push(timeUs, TRACE_START, note, frequency);
+}
+
+void PlaybackTrace::stop(uint32_t timeUs, uint16_t note) {
+  push(timeUs, TRACE_STOP, note, 0);
+}
+
+void PlaybackTrace::anchor(uint32_t timeUs, uint16_t note, uint16_t speedPermille) {
+  push(timeUs, TRACE_ANCHOR, note, speedPermille);
+}
+
+void PlaybackTrace::push(uint32_t timeUs, TraceKind kind, uint16_t note, uint16_t value) {
+  if (_count == TRACE_CAPACITY) {
+    _first = (_first + 1) % TRACE_CAPACITY;
+    _count--;
+    _overwritten++;
+  }
+
+  TraceEvent &event = _events[(_first + _count) % TRACE_CAPACITY];
+  event.timeUs = timeUs;
+  event.kind = kind;
+  event.note = note;
+  event.value = value;
+  _count++;
+}
+
+void PlaybackTrace::dump(TraceLineWriter write) const {
+  if (!_started)
+    return;
+
+  char line[40];
+  format(_song, line, sizeof(line));
+  write(line);
+  for (size_t i = 0; i < _count; i++) {
+    format(at(i), line, sizeof(line));
+    write(line);
+  }
+  snprintf(line, sizeof(line), "end %lu", (unsigned long)_overwritten);
+  write(line);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+// RAM budget: static, heap and stack usage with high-water marks.
+//
+// begin() paints the free space between the heap and the stack with a
+// pattern; the deepest stack excursion is where the paint stops. The heap
+// peak is newlib's arena, which only ever grows. Subsystems register what
+// they hold, and report() breaks static and heap usage down by them; the
+// rest of .data/.bss is the core and small globals.
+
+#define RAM_BUDGET_MAX_ENTRIES 16
+#define RAM_BUDGET_PAINT 0xA5A5A5A5
+#define RAM_BUDGET_STACK_GUARD 128 // bytes below SP left alone in begin()
+
+class RamBudget {
+public:
+  // Call first thing in setup()
+  void begin();
+
+  // A static object, or a heap allocation made at boot
+  void add(const char *name, size_t bytes, bool heap = false);
+
+  uint32_t staticBytes() const;
+  uint32_t heapInUse() const;
+  uint32_t heapPeak() const;
+  uint32_t stackPeak() const;
+  // Never touched so far, between the heap peak and the deepest stack
+  uint32_t headroom() const;
+
+  void report(Print &out) const;
+
+private:
+  struct Entry {
+    const char *name;
+    uint32_t bytes;
+    bool heap;
+  };
+
+  const uint32_t *stackLowWater() const;
+
+  Entry _entries[RAM_BUDGET_MAX_ENTRIES];
+  uint8_t _count = 0;
+  const uint32_t *_paintStart = nullptr;
+};
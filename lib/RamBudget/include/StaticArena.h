@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+#include <new>
+
+// A fixed block for objects that are only created at run time, e.g. once a
+// device has answered, instead of new on the heap.
+//
+// Every slot is one of the Types, laid out in order at compile time, so the
+// allocation map is known at link time and an arena too small for its slots
+// is a build error. Each slot is constructed at most once and never freed.
+
+constexpr size_t arenaAlign(size_t at, size_t alignment) {
+  return (at + alignment - 1) / alignment * alignment;
+}
+
+// End of the slots laid out from `at`
+template <typename... Types> struct ArenaMap {
+  static constexpr size_t end(size_t at) { return at; }
+};
+
+template <typename T, typename... Rest> struct ArenaMap<T, Rest...> {
+  static constexpr size_t end(size_t at) { return ArenaMap<Rest...>::end(arenaAlign(at, alignof(T)) + sizeof(T)); }
+};
+
+// Type and offset of slot Index
+template <size_t Index, typename... Types> struct ArenaSlot;
+
+template <typename T, typename... Rest> struct ArenaSlot<0, T, Rest...> {
+  typedef T Type;
+  static constexpr size_t offset(size_t at) { return arenaAlign(at, alignof(T)); }
+};
+
+template <size_t Index, typename T, typename... Rest> struct ArenaSlot<Index, T, Rest...> {
+  typedef typename ArenaSlot<Index - 1, Rest...>::Type Type;
+  static constexpr size_t offset(size_t at) {
+    return ArenaSlot<Index - 1, Rest...>::offset(arenaAlign(at, alignof(T)) + sizeof(T));
+  }
+};
+
+template <size_t Size, typename... Types> class StaticArena {
+public:
+  static constexpr size_t slots = sizeof...(Types);
+  static constexpr size_t used = ArenaMap<Types...>::end(0);
+  static_assert(used <= Size, "StaticArena: the slots do not fit, raise the arena size");
+  static_assert(slots <= 32, "StaticArena: at most 32 slots");
+
+  // Constructs slot Index in place; later calls return the same object
+  template <size_t Index, typename... Args> typename ArenaSlot<Index, Types...>::Type *create(Args &&...args) {
+    typedef typename ArenaSlot<Index, Types...>::Type T;
+    if (!(_created & (1UL << Index))) {
+      new (_storage + ArenaSlot<Index, Types...>::offset(0)) T(static_cast<Args &&>(args)...);
+      _created |= 1UL << Index;
+    }
+    return get<Index>();
+  }
+
+  // nullptr until created
+  template <size_t Index> typename ArenaSlot<Index, Types...>::Type *get() {
+    typedef typename ArenaSlot<Index, Types...>::Type T;
+    if (!(_created & (1UL << Index)))
+      return nullptr;
+    return reinterpret_cast<T *>(_storage + ArenaSlot<Index, Types...>::offset(0));
+  }
+
+  // The allocation map, one line per slot, names in slot order
+  void report(Print &out, const char *const names[]) const {
+    const size_t sizes[] = {sizeof(Types)...};
+    const size_t alignments[] = {alignof(Types)...};
+    out.printf("arena %u B, %u used\n", (unsigned)Size, (unsigned)used);
+    size_t at = 0;
+    for (size_t i = 0; i < slots; i++) {
+      at = arenaAlign(at, alignments[i]);
+      out.printf(" %-20s @%4u %6u %s\n", names[i], (unsigned)at, (unsigned)sizes[i],
+                 (_created & (1UL << i)) ? "created" : "unused");
+      at += sizes[i];
+    }
+  }
+
+private:
+  alignas(8) uint8_t _storage[Size];
+  uint32_t _created = 0;
+};
@@ -0,0 +1,75 @@
+#include "RamBudget.h"
+#include <malloc.h>
+#include <unistd.h>
+
+// From the linker script
+extern "C" uint32_t _sdata, _edata, _sbss, _ebss, _estack;
+
+static const uint32_t *heapTop() {
+  uintptr_t top = (uintptr_t)sbrk(0);
+  return (const uint32_t *)((top + 3) & ~(uintptr_t)3);
+}
+
+void RamBudget::begin() {
+  uint32_t *from = (uint32_t *)heapTop();
+  uint32_t *to = (uint32_t *)(__get_MSP() - RAM_BUDGET_STACK_GUARD);
+  for (uint32_t *p = from; p < to; p++)
+    *p = RAM_BUDGET_PAINT;
+  _paintStart = from;
+}
+
+void RamBudget::add(const char *name, size_t bytes, bool heap) {
+  if (_count >= RAM_BUDGET_MAX_ENTRIES)
+    return;
+  _entries[_count++] = {name, (uint32_t)bytes, heap};
+}
+
+uint32_t RamBudget::staticBytes() const {
+  return ((uint32_t)&_edata - (uint32_t)&_sdata) + ((uint32_t)&_ebss - (uint32_t)&_sbss);
+}
+
+uint32_t RamBudget::heapInUse() const {
+  return mallinfo().uordblks;
+}
+
+uint32_t RamBudget::heapPeak() const {
+  return mallinfo().arena;
+}
+
+const uint32_t *RamBudget::stackLowWater() const {
+  if (_paintStart == nullptr)
+    return (const uint32_t *)__get_MSP();
+
+  // Heap growth also overwrites paint, so start above the current heap
+  const uint32_t *p = max(_paintStart, heapTop());
+  const uint32_t *sp = (const uint32_t *)__get_MSP();
+  while (p < sp && *p == RAM_BUDGET_PAINT)
+    p++;
+  return p;
+}
+
+uint32_t RamBudget::stackPeak() const {
+  return (uint32_t)&_estack - (uint32_t)stackLowWater();
+}
+
+uint32_t RamBudget::headroom() const {
+  return (uint32_t)stackLowWater() - (uint32_t)heapTop();
+}
+
+void RamBudget::report(Print &out) const {
+  uint32_t total = (uint32_t)&_estack - (uint32_t)&_sdata;
+  uint32_t data = (uint32_t)&_edata - (uint32_t)&_sdata;
+  uint32_t bss = (uint32_t)&_ebss - (uint32_t)&_sbss;
+
+  out.printf("ram %lu B: static %lu (data %lu, bss %lu), heap %lu peak %lu, stack peak %lu, headroom %lu\n",
+             total, data + bss, data, bss, heapInUse(), heapPeak(), stackPeak(), headroom());
+
+  uint32_t listedStatic = 0;
+  for (uint8_t i = 0; i < _count; i++) {
+    const Entry &entry = _entries[i];
+    out.printf(" %-20s %6lu %s\n", entry.name, entry.bytes, entry.heap ? "heap" : "static");
+    if (!entry.heap)
+      listedStatic += entry.bytes;
+  }
+  out.printf(" %-20s %6lu static\n", "core and other", data + bss - min(listedStatic, data + bss));
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+
+// Playback position journal in internal flash.
+//
+// States are appended as 10-byte CRC-protected records to a ring of flash
+// pages just below the EEPROM emulation page. Appending never rewrites a
+// record, and pages are erased in ring order, so wear spreads evenly across
+// all of them. On boot the record with the highest sequence number wins.
+//
+// The F103 has a single flash bank: the CPU stalls while flash is being
+// written, ~70us per half-word and 20-40ms per page erase. record() therefore
+// only updates RAM; service() does the actual work and is told by the caller
+// whether a long stall is acceptable right now (paused, between songs, rests).
+
+#define RESUME_JOURNAL_PAGES 8
+#define RESUME_JOURNAL_PAGE_SIZE 1024
+#define RESUME_JOURNAL_END (FLASH_BANK1_END + 1 - RESUME_JOURNAL_PAGE_SIZE) // EEPROM emulation page
+#define RESUME_JOURNAL_BASE (RESUME_JOURNAL_END - RESUME_JOURNAL_PAGES * RESUME_JOURNAL_PAGE_SIZE)
+
+// Position updates within a song are written on note boundaries, at most
+// this often, so a reset loses at most this much of the song; song and speed
+// changes and pauses are written at the next opportunity. 8 pages of 102
+// records at 10k erase cycles last for ~8M records: with a song change every
+// 3 minutes on top, ~6.5 years of round-the-clock playback.
+#define RESUME_JOURNAL_INTERVAL_MS 30000
+
+// Records with another version are ignored
+#define RESUME_JOURNAL_VERSION 2
+
+struct ResumeState {
+  uint16_t song = 0; // catalog index, streamed and uploaded songs included
+  uint8_t speedSettingIdx = 0;
+  uint16_t noteIdx = 0;
+};
+
+class ResumeJournal {
+public:
+  // Scans the journal for the latest valid record. Returns false if there is
+  // none, or if the firmware image overlaps the journal pages.
+  bool begin();
+
+  const ResumeState &state() const { return _state; }
+
+  // Remembers the state; persisted by a later service() call
+  void record(const ResumeState &state);
+
+  // Programs a pending record (a few hundred us of stall). With allowErase,
+  // also prepares the next page if needed (tens of ms of stall).
+  void service(bool allowErase);
+  // service() without waiting out RESUME_JOURNAL_INTERVAL_MS, e.g. on pause
+  void flush(bool allowErase);
+
+private:
+  struct Record {
+    uint8_t version;
+    uint8_t speedSettingIdx;
+    uint16_t song;
+    uint16_t noteIdx;
+    uint16_t sequence;
+    uint16_t crc;
+  };
+
+  // Records never straddle a page, the few bytes left at the end stay erased
+  static const uint16_t RECORDS_PER_PAGE = RESUME_JOURNAL_PAGE_SIZE / sizeof(Record);
+  static const uint16_t RECORD_COUNT = RECORDS_PER_PAGE * RESUME_JOURNAL_PAGES;
+
+  static const Record *slot(uint16_t index);
+  static bool isErased(const Record *record);
+  static uint16_t crc16(const uint8_t *data, size_t length);
+  bool nextPageReady() const;
+  bool program(const Record &record);
+  bool erasePage(uint16_t page);
+
+  bool _enabled = false;
+  ResumeState _state;
+  ResumeState _pending;
+  bool _dirty = false;
+  bool _urgent = false; // song or speed changed
+  uint32_t _lastWriteMs = 0;
+  uint16_t _sequence = 0;
+  uint16_t _next = 0; // slot index of the next append
+};
@@ -0,0 +1,161 @@
+#include "ResumeJournal.h"
+
+// Linker symbols: the initialized data image is stored right after the code
+extern "C" uint32_t _sidata, _sdata, _edata;
+
+const ResumeJournal::Record *ResumeJournal::slot(uint16_t index) {
+  uint16_t page = index / RECORDS_PER_PAGE;
+  uint16_t offset = index % RECORDS_PER_PAGE;
+  return (const Record *)(RESUME_JOURNAL_BASE + (uint32_t)page * RESUME_JOURNAL_PAGE_SIZE +
+                          offset * sizeof(Record));
+}
+
+bool ResumeJournal::isErased(const Record *record) {
+  const uint16_t *halfWords = (const uint16_t *)record;
+  for (uint8_t i = 0; i < sizeof(Record) / 2; i++)
+    if (halfWords[i] != 0xFFFF)
+      return false;
+  return true;
+}
+
+// CRC-16/CCITT-FALSE
+uint16_t ResumeJournal::crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+bool ResumeJournal::begin() {
+  uint32_t imageEnd = (uint32_t)&_sidata + ((uint32_t)&_edata - (uint32_t)&_sdata);
+  if (imageEnd > RESUME_JOURNAL_BASE)
+    return false;
+  _enabled = true;
+
+  int32_t latest = -1;
+  for (uint16_t i = 0; i < RECORD_COUNT; i++) {
+    const Record *record = slot(i);
+    if (isErased(record))
+      continue;
+    if (crc16((const uint8_t *)record, offsetof(Record, crc)) != record->crc)
+      continue; // torn write or leftovers from another firmware
+    if (record->version != RESUME_JOURNAL_VERSION)
+      continue;
+    if (latest < 0 || (int16_t)(record->sequence - slot(latest)->sequence) > 0)
+      latest = i;
+  }
+
+  if (latest < 0)
+    return false;
+
+  const Record *record = slot(latest);
+  _state.song = record->song;
+  _state.speedSettingIdx = record->speedSettingIdx;
+  _state.noteIdx = record->noteIdx;
+  _pending = _state;
+  _sequence = record->sequence + 1;
+  _next = (latest + 1) % RECORD_COUNT;
+  return true;
+}
+
+void ResumeJournal::record(const ResumeState &state) {
+  if (!_enabled)
+    return;
+
+  if (state.song != _state.song || state.speedSettingIdx != _state.speedSettingIdx)
+    _urgent = true;
+  _dirty = _urgent || state.noteIdx != _state.noteIdx;
+  _pending = state;
+}
+
+bool ResumeJournal::nextPageReady() const {
+  uint16_t page = (_next / RECORDS_PER_PAGE + 1) % RESUME_JOURNAL_PAGES;
+  const uint32_t *words = (const uint32_t *)slot(page * RECORDS_PER_PAGE);
+  for (uint16_t i = 0; i < RESUME_JOURNAL_PAGE_SIZE / 4; i++)
+    if (words[i] != 0xFFFFFFFF)
+      return false;
+  return true;
+}
+
+void ResumeJournal::flush(bool allowErase) {
+  if (_dirty)
+    _urgent = true;
+  service(allowErase);
+}
+
+void ResumeJournal::service(bool allowErase) {
+  if (!_enabled)
+    return;
+
+  // Erase ahead once the current page is half used, so a page switch never
+  // has to wait for a moment where a long stall is acceptable
+  if (allowErase && (_next % RECORDS_PER_PAGE) >= RECORDS_PER_PAGE / 2 && !nextPageReady())
+    erasePage((_next / RECORDS_PER_PAGE + 1) % RESUME_JOURNAL_PAGES);
+
+  if (!_dirty)
+    return;
+  if (!_urgent && millis() - _lastWriteMs < RESUME_JOURNAL_INTERVAL_MS)
+    return;
+
+  // Skip slots a reset left half-programmed; never erase the page we are
+  // appending to, it holds the latest record
+  while ((_next % RECORDS_PER_PAGE) != 0 && !isErased(slot(_next)))
+    _next = (_next + 1) % RECORD_COUNT;
+
+  if (!isErased(slot(_next))) {
+    if (!allowErase)
+      return; // deferred, the newest pending state is kept
+    if (!erasePage(_next / RECORDS_PER_PAGE))
+      return;
+  }
+
+  Record record;
+  record.version = RESUME_JOURNAL_VERSION;
+  record.song = _pending.song;
+  record.speedSettingIdx = _pending.speedSettingIdx;
+  record.noteIdx = _pending.noteIdx;
+  record.sequence = _sequence;
+  record.crc = crc16((const uint8_t *)&record, offsetof(Record, crc));
+
+  if (!program(record)) {
+    // Leave the slot behind, the CRC rejects whatever made it to flash
+    _next = (_next + 1) % RECORD_COUNT;
+    return;
+  }
+
+  _state = _pending;
+  _dirty = false;
+  _urgent = false;
+  _lastWriteMs = millis();
+  _sequence++;
+  _next = (_next + 1) % RECORD_COUNT;
+}
+
+bool ResumeJournal::program(const Record &record) {
+  uint32_t address = (uint32_t)slot(_next);
+  const uint16_t *halfWords = (const uint16_t *)&record;
+
+  HAL_FLASH_Unlock();
+  bool ok = true;
+  for (uint8_t i = 0; i < sizeof(Record) / 2 && ok; i++)
+    ok = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, address + i * 2, halfWords[i]) == HAL_OK;
+  HAL_FLASH_Lock();
+  return ok;
+}
+
+bool ResumeJournal::erasePage(uint16_t page) {
+  FLASH_EraseInitTypeDef erase = {};
+  erase.TypeErase = FLASH_TYPEERASE_PAGES;
+  erase.Banks = FLASH_BANK_1;
+  erase.PageAddress = (uint32_t)slot(page * RECORDS_PER_PAGE);
+  erase.NbPages = 1;
+  uint32_t pageError = 0;
+
+  HAL_FLASH_Unlock();
+  bool ok = HAL_FLASHEx_Erase(&erase, &pageError) == HAL_OK;
+  HAL_FLASH_Lock();
+  return ok;
+}
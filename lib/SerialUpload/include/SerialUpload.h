@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+
+// Song upload over the ST-Link virtual COM port (USART2) while playing.
+//
+// The RX side of Serial is taken over by DMA1 channel 6, so received bytes
+// never go through the CPU:
+//   idle       circular DMA into a small command ring, scanned from poll()
+//   header     'N' 'U', u32 length, u32 CRC-32 of the payload (little-endian)
+//   reply      'R' ready, or 'B' busy / too large
+//   payload    one-shot DMA straight into the upload buffer
+//   reply      'K' verified, 'E' CRC mismatch or timeout
+// A '?' outside a header asks for a status report, see takeQuery().
+//
+// The payload is a song bank image (see SongStream.h) holding one song; the
+// CRC is computed incrementally from poll() while the bytes arrive.
+// tools/upload_song.py implements the host side.
+
+#define SERIAL_UPLOAD_BUFFER_SIZE 8192 // 2000 notes plus the bank header
+#define SERIAL_UPLOAD_COMMAND_RING 32
+#define SERIAL_UPLOAD_TIMEOUT_MS 1000
+#define SERIAL_UPLOAD_CRC_CHUNK 512 // bytes checked per poll()
+
+class SerialUpload {
+public:
+  enum Event { NONE, STARTED, DONE, FAILED };
+
+  // Call after serial.begin(); from then on Serial can only transmit
+  void begin(HardwareSerial &serial);
+
+  // Runs the protocol. STARTED means the upload buffer is about to be
+  // overwritten, DONE that it holds a verified image.
+  Event poll();
+
+  // True once after a '?' was received
+  bool takeQuery() {
+    bool query = _query;
+    _query = false;
+    return query;
+  }
+
+  // While locked (the uploaded song is playing) new uploads are refused
+  void setLocked(bool locked) { _locked = locked; }
+
+  // No upload under way and Serial done transmitting, so the baud rate may
+  // change
+  bool idle() const;
+  // Call with interrupts off after the APB1 clock changed; Serial runs at baud
+  void clockChanged(uint32_t baud);
+
+  const uint8_t *image() const { return _buffer; }
+  uint32_t imageSize() const { return _length; }
+  uint32_t lastTransferMs() const { return _lastTransferMs; }
+
+private:
+  enum State { IDLE, RECEIVING };
+
+  void startCommandDma();
+  void startPayloadDma(uint32_t length);
+  uint32_t received() const;
+  Event finish(bool ok);
+
+  HardwareSerial *_serial = nullptr;
+  State _state = IDLE;
+  bool _locked = false;
+  bool _query = false;
+
+  uint8_t _ring[SERIAL_UPLOAD_COMMAND_RING];
+  uint16_t _ringRead = 0;
+  uint8_t _header[10];
+  uint8_t _headerLength = 0;
+
+  uint8_t _buffer[SERIAL_UPLOAD_BUFFER_SIZE];
+  uint32_t _length = 0;
+  uint32_t _expectedCrc = 0;
+  uint32_t _crc = 0;
+  uint32_t _crcPosition = 0;
+  uint32_t _lastProgress = 0;
+  uint32_t _lastProgressMs = 0;
+  uint32_t _startMs = 0;
+  uint32_t _lastTransferMs = 0;
+};
@@ -0,0 +1,151 @@
+#include "SerialUpload.h"
+
+// Serial on the Nucleo is USART2, whose RX request is wired to DMA1 channel 6
+#define UPLOAD_USART USART2
+#define UPLOAD_DMA DMA1_Channel6
+
+#define REPLY_READY 'R'
+#define REPLY_BUSY 'B'
+#define REPLY_OK 'K'
+#define REPLY_ERROR 'E'
+
+// CRC-32 (zlib), one nibble at a time to keep the table at 64 bytes
+static uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t length) {
+  static const uint32_t table[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+      0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+      0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+  while (length--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+  }
+  return crc;
+}
+
+static uint32_t readU32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void SerialUpload::begin(HardwareSerial &serial) {
+  _serial = &serial;
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  // Stop the core's per-byte RX interrupt. Error interrupts go too: the HAL
+  // error handler would clear DMAR and abort our transfer.
+  UPLOAD_USART->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_PEIE);
+  UPLOAD_USART->CR3 &= ~USART_CR3_EIE;
+  UPLOAD_USART->CR3 |= USART_CR3_DMAR;
+
+  startCommandDma();
+}
+
+void SerialUpload::startCommandDma() {
+  UPLOAD_DMA->CCR = 0;
+  UPLOAD_DMA->CPAR = (uint32_t)&UPLOAD_USART->DR;
+  UPLOAD_DMA->CMAR = (uint32_t)_ring;
+  UPLOAD_DMA->CNDTR = SERIAL_UPLOAD_COMMAND_RING;
+  UPLOAD_DMA->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_EN;
+  _ringRead = 0;
+  _headerLength = 0;
+  _state = IDLE;
+}
+
+void SerialUpload::startPayloadDma(uint32_t length) {
+  UPLOAD_DMA->CCR = 0;
+  UPLOAD_DMA->CMAR = (uint32_t)_buffer;
+  UPLOAD_DMA->CNDTR = length;
+  UPLOAD_DMA->CCR = DMA_CCR_MINC | DMA_CCR_EN;
+
+  _length = length;
+  _crc = 0xFFFFFFFF;
+  _crcPosition = 0;
+  _lastProgress = 0;
+  _startMs = _lastProgressMs = millis();
+  _state = RECEIVING;
+}
+
+uint32_t SerialUpload::received() const {
+  return _length - UPLOAD_DMA->CNDTR;
+}
+
+SerialUpload::Event SerialUpload::poll() {
+  if (_serial == nullptr)
+    return NONE;
+
+  if (_state == IDLE) {
+    // CNDTR counts down and reloads, so this is the DMA write position
+    uint16_t write = SERIAL_UPLOAD_COMMAND_RING - UPLOAD_DMA->CNDTR;
+
+    while (_ringRead != write) {
+      uint8_t value = _ring[_ringRead];
+      _ringRead = (_ringRead + 1) % SERIAL_UPLOAD_COMMAND_RING;
+
+      if (_headerLength == 0 && value == '?') {
+        _query = true;
+        continue;
+      }
+
+      // Resynchronize on the magic, anything else is line noise
+      if ((_headerLength == 0 && value != 'N') || (_headerLength == 1 && value != 'U')) {
+        _headerLength = (value == 'N') ? 1 : 0;
+        if (_headerLength)
+          _header[0] = value;
+        continue;
+      }
+      _header[_headerLength++] = value;
+      if (_headerLength < sizeof(_header))
+        continue;
+
+      _headerLength = 0;
+      uint32_t length = readU32(_header + 2);
+      if (_locked || length == 0 || length > SERIAL_UPLOAD_BUFFER_SIZE) {
+        _serial->write(REPLY_BUSY);
+        continue;
+      }
+
+      _expectedCrc = readU32(_header + 6);
+      startPayloadDma(length);
+      _serial->write(REPLY_READY);
+      return STARTED;
+    }
+    return NONE;
+  }
+
+  uint32_t now = millis();
+  uint32_t available = received();
+  if (available != _lastProgress) {
+    _lastProgress = available;
+    _lastProgressMs = now;
+  } else if (now - _lastProgressMs > SERIAL_UPLOAD_TIMEOUT_MS) {
+    return finish(false);
+  }
+
+  // Verify what has arrived so far, a bounded amount per call
+  uint32_t chunk = min(available - _crcPosition, (uint32_t)SERIAL_UPLOAD_CRC_CHUNK);
+  _crc = crc32Update(_crc, _buffer + _crcPosition, chunk);
+  _crcPosition += chunk;
+
+  if (_crcPosition == _length)
+    return finish(~_crc == _expectedCrc);
+  return NONE;
+}
+
+SerialUpload::Event SerialUpload::finish(bool ok) {
+  _lastTransferMs = millis() - _startMs;
+  if (!ok)
+    _length = 0;
+  _serial->write(ok ? REPLY_OK : REPLY_ERROR);
+  startCommandDma();
+  return ok ? DONE : FAILED;
+}
+
+bool SerialUpload::idle() const {
+  return _state == IDLE && (UPLOAD_USART->SR & USART_SR_TC) &&
+         _serial->availableForWrite() >= SERIAL_TX_BUFFER_SIZE - 1;
+}
+
+void SerialUpload::clockChanged(uint32_t baud) {
+  UPLOAD_USART->BRR = (HAL_RCC_GetPCLK1Freq() + baud / 2) / baud;
+}
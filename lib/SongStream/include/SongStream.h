@@ -0,0 +1,128 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Songs streamed from external storage (SPI NOR flash on the board, a plain
+// file on the host), so the catalog is not capped by internal flash.
+//
+// Image layout, all little-endian:
+//   header   magic "NSB1", u16 song count, u16 entry size
+//   entries  one SongBankEntry per song
+//   melodies per song, `length` pairs of i16 frequency, i16 divider
+//            (the same encoding as Song::melody)
+//
+// SongStream reads ahead of the playback cursor into a small ring buffer.
+// fill() is called from the player's idle time, so by the time a note is
+// due it is already in RAM and a slow read never delays it.
+
+#define SONG_BANK_MAGIC 0x3142534EUL // "NSB1"
+#define SONG_BANK_NAME_SIZE 24
+#define SONG_BANK_NOTE_SIZE 4
+
+#define SONG_STREAM_BUFFER_SIZE 256 // power of two, 64 notes
+#define SONG_STREAM_CHUNK_SIZE 32   // one storage read, divides the buffer
+
+struct SongBankEntry {
+  uint32_t offset;     // of the melody, from the start of the image
+  uint32_t durationMs; // precomputed by the packer
+  uint16_t length;     // notes
+  uint16_t tempo;
+  char name[SONG_BANK_NAME_SIZE]; // NUL-terminated
+};
+
+#define SONG_BANK_HEADER_SIZE 8
+#define SONG_BANK_ENTRY_SIZE 36
+
+// Random-access backing store
+class SongStorage {
+public:
+  virtual ~SongStorage() {}
+  virtual bool read(uint32_t address, uint8_t *buffer, size_t length) = 0;
+};
+
+// An image already in RAM, e.g. one received over serial
+class RamStorage : public SongStorage {
+public:
+  RamStorage(const uint8_t *data = nullptr, size_t size = 0) : _data(data), _size(size) {}
+  bool read(uint32_t address, uint8_t *buffer, size_t length) override;
+
+private:
+  const uint8_t *_data;
+  size_t _size;
+};
+
+#ifdef ARDUINO
+// JEDEC SPI NOR flash (W25Qxx and friends) on the default SPI bus
+class SpiNorStorage : public SongStorage {
+public:
+  SpiNorStorage(uint32_t csPin, uint32_t clockHz = 18000000);
+
+  // Returns false if no flash answers the JEDEC ID command
+  bool begin();
+  bool read(uint32_t address, uint8_t *buffer, size_t length) override;
+
+private:
+  uint32_t _csPin;
+  uint32_t _clockHz;
+};
+#else
+#include <stdio.h>
+
+// Host stand-in: the image is an ordinary file. An optional per-read delay
+// simulates slow storage.
+class FileStorage : public SongStorage {
+public:
+  explicit FileStorage(const char *path, unsigned readDelayUs = 0);
+  ~FileStorage();
+  bool read(uint32_t address, uint8_t *buffer, size_t length) override;
+
+  unsigned reads() const { return _reads; }
+
+private:
+  FILE *_file;
+  unsigned _readDelayUs;
+  unsigned _reads = 0;
+};
+#endif
+
+class SongBank {
+public:
+  // Validates the image header; an absent or blank chip gives an empty bank
+  bool begin(SongStorage &storage);
+
+  uint16_t count() const { return _count; }
+  bool entry(uint16_t index, SongBankEntry &out) const;
+  SongStorage *storage() const { return _storage; }
+
+private:
+  SongStorage *_storage = nullptr;
+  uint16_t _count = 0;
+};
+
+class SongStream {
+public:
+  // Positions the stream at startNote of song `index` and primes the buffer
+  bool open(const SongBank &bank, uint16_t index, uint16_t startNote = 0);
+
+  // Pops the next note. If the buffer ran dry it reads synchronously and
+  // counts an underrun. Returns false at the end of the song.
+  bool next(int &frequency, int &divider);
+
+  // Reads ahead into free buffer space, one chunk at a time
+  void fill();
+
+  const SongBankEntry &entry() const { return _entry; }
+  uint32_t underruns() const { return _underruns; }
+
+private:
+  uint16_t used() const { return _tail - _head; }
+
+  SongStorage *_storage = nullptr;
+  SongBankEntry _entry;
+  uint8_t _buffer[SONG_STREAM_BUFFER_SIZE];
+  uint16_t _head = 0; // free-running byte counters, masked on access
+  uint16_t _tail = 0;
+  uint32_t _readAddress = 0;
+  uint32_t _endAddress = 0;
+  uint32_t _underruns = 0;
+};
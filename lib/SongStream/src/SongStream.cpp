@@ -0,0 +1,162 @@
+#include "SongStream.h"
+#include <string.h>
+
+static uint16_t readU16(const uint8_t *p) {
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t readU32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool RamStorage::read(uint32_t address, uint8_t *buffer, size_t length) {
+  if (address > _size || length > _size - address)
+    return false;
+  memcpy(buffer, _data + address, length);
+  return true;
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <SPI.h>
+
+#define SPI_NOR_READ_DATA 0x03
+#define SPI_NOR_READ_JEDEC_ID 0x9F
+
+SpiNorStorage::SpiNorStorage(uint32_t csPin, uint32_t clockHz) : _csPin(csPin), _clockHz(clockHz) {}
+
+bool SpiNorStorage::begin() {
+  pinMode(_csPin, OUTPUT);
+  digitalWrite(_csPin, HIGH);
+  SPI.begin();
+
+  uint8_t id[3];
+  SPI.beginTransaction(SPISettings(_clockHz, MSBFIRST, SPI_MODE0));
+  digitalWrite(_csPin, LOW);
+  SPI.transfer(SPI_NOR_READ_JEDEC_ID);
+  for (uint8_t i = 0; i < sizeof(id); i++)
+    id[i] = SPI.transfer(0xFF);
+  digitalWrite(_csPin, HIGH);
+  SPI.endTransaction();
+
+  // Floating MISO reads all ones, a missing pull-up all zeros
+  return !(id[0] == 0xFF || id[0] == 0x00);
+}
+
+bool SpiNorStorage::read(uint32_t address, uint8_t *buffer, size_t length) {
+  // A chunk is ~20us at 18 MHz, short enough to run between UI frames
+  SPI.beginTransaction(SPISettings(_clockHz, MSBFIRST, SPI_MODE0));
+  digitalWrite(_csPin, LOW);
+  SPI.transfer(SPI_NOR_READ_DATA);
+  SPI.transfer((address >> 16) & 0xFF);
+  SPI.transfer((address >> 8) & 0xFF);
+  SPI.transfer(address & 0xFF);
+  memset(buffer, 0xFF, length);
+  SPI.transfer(buffer, length);
+  digitalWrite(_csPin, HIGH);
+  SPI.endTransaction();
+  return true;
+}
+#else
+#include <unistd.h>
+
+FileStorage::FileStorage(const char *path, unsigned readDelayUs)
+    : _file(fopen(path, "rb")), _readDelayUs(readDelayUs) {}
+
+FileStorage::~FileStorage() {
+  if (_file)
+    fclose(_file);
+}
+
+bool FileStorage::read(uint32_t address, uint8_t *buffer, size_t length) {
+  if (_file == nullptr || fseek(_file, address, SEEK_SET) != 0)
+    return false;
+  _reads++;
+  if (_readDelayUs)
+    usleep(_readDelayUs);
+  return fread(buffer, 1, length, _file) == length;
+}
+#endif
+
+bool SongBank::begin(SongStorage &storage) {
+  _storage = &storage;
+  _count = 0;
+
+  uint8_t header[SONG_BANK_HEADER_SIZE];
+  if (!storage.read(0, header, sizeof(header)))
+    return false;
+  if (readU32(header) != SONG_BANK_MAGIC || readU16(header + 6) != SONG_BANK_ENTRY_SIZE)
+    return false;
+
+  _count = readU16(header + 4);
+  return true;
+}
+
+bool SongBank::entry(uint16_t index, SongBankEntry &out) const {
+  if (index >= _count)
+    return false;
+
+  uint8_t raw[SONG_BANK_ENTRY_SIZE];
+  if (!_storage->read(SONG_BANK_HEADER_SIZE + (uint32_t)index * SONG_BANK_ENTRY_SIZE, raw, sizeof(raw)))
+    return false;
+
+  out.offset = readU32(raw);
+  out.durationMs = readU32(raw + 4);
+  out.length = readU16(raw + 8);
+  out.tempo = readU16(raw + 10);
+  memcpy(out.name, raw + 12, SONG_BANK_NAME_SIZE);
+  out.name[SONG_BANK_NAME_SIZE - 1] = '\0';
+  return out.tempo != 0;
+}
+
+bool SongStream::open(const SongBank &bank, uint16_t index, uint16_t startNote) {
+  _storage = nullptr;
+  if (!bank.entry(index, _entry) || startNote > _entry.length)
+    return false;
+
+  _storage = bank.storage();
+  _head = _tail = 0;
+  _readAddress = _entry.offset + (uint32_t)startNote * SONG_BANK_NOTE_SIZE;
+  _endAddress = _entry.offset + (uint32_t)_entry.length * SONG_BANK_NOTE_SIZE;
+  fill();
+  return true;
+}
+
+void SongStream::fill() {
+  if (_storage == nullptr)
+    return;
+
+  while (_readAddress < _endAddress && SONG_STREAM_BUFFER_SIZE - used() >= SONG_STREAM_CHUNK_SIZE) {
+    // _tail only moves in whole chunks until the last one, so a chunk never
+    // wraps around the end of the buffer
+    uint32_t length = _endAddress - _readAddress;
+    if (length > SONG_STREAM_CHUNK_SIZE)
+      length = SONG_STREAM_CHUNK_SIZE;
+
+    uint8_t *dest = _buffer + (_tail & (SONG_STREAM_BUFFER_SIZE - 1));
+    if (!_storage->read(_readAddress, dest, length))
+      return;
+    _readAddress += length;
+    _tail += length;
+  }
+}
+
+bool SongStream::next(int &frequency, int &divider) {
+  if (_storage == nullptr)
+    return false;
+
+  if (used() < SONG_BANK_NOTE_SIZE) {
+    if (_readAddress >= _endAddress)
+      return false;
+    _underruns++;
+    fill();
+    if (used() < SONG_BANK_NOTE_SIZE)
+      return false;
+  }
+
+  const uint8_t *note = _buffer + (_head & (SONG_STREAM_BUFFER_SIZE - 1));
+  frequency = (int16_t)readU16(note);
+  divider = (int16_t)readU16(note + 2);
+  _head += SONG_BANK_NOTE_SIZE;
+  return true;
+}
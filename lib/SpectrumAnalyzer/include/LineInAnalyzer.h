@@ -0,0 +1,58 @@
+#pragma once
+#include <Arduino.h>
+#include "Spectrum.h"
+
+// Spectrum of an analog line input, in the visualizer's bands.
+//
+// ADC1 converts the input continuously and DMA1 channel 1 fills two
+// capture buffers of SPECTRUM_SIZE * SPECTRUM_DECIMATION samples in turn,
+// circular and without interrupts, so capturing never waits for the loop.
+// update() polls the DMA's half and full flags and analyzes the buffer
+// filled last in place (see Spectrum.h). Every timer that could pace the
+// ADC is taken, so the rate comes from the conversion time: 9 MHz / 252
+// cycles, 35.7 kHz, decimated to 8.9 kHz. That is as slow as the ADC goes,
+// for the longest capture a buffer holds: 28.7 ms, 34.9 Hz per bin, so
+// even the 33 Hz wide bass bands get a bin each. A loop that polls at least
+// once per capture gets every capture as a frame, 34.9 a second; a frame
+// whose buffer the DMA came back to during the analysis is dropped.
+//
+// The input wants a DC bias to mid-supply; the mean is removed anyway.
+// analogRead() must not be used with the analyzer on, it reconfigures ADC1.
+
+// PCLK2 / 8, the slowest ADC clock. The prescaler is shared with the input
+// sampler's ADC2, whose conversions only get a little longer.
+#define LINE_IN_ADC_PRESCALER 8
+// 239.5 sample + 12.5 conversion cycles
+#define LINE_IN_SAMPLE_TIME 7
+#define LINE_IN_CONVERSION_CYCLES 252
+#define LINE_IN_CAPTURE_SIZE (SPECTRUM_SIZE * SPECTRUM_DECIMATION)
+
+class LineInAnalyzer {
+public:
+  // channel is the ADC12_IN number, boundaries as for SpectrumBands
+  void begin(uint8_t channel, const uint16_t *boundaries);
+
+  // Analyzes a finished capture into levels[SPECTRUM_BANDS]; false if none
+  // has finished since the last call
+  bool update(uint8_t *levels);
+
+  uint32_t sampleRateHz() const { return _sampleRateHz; }
+  // Analyzed frames per second, captures missed, and CPU cycles per frame
+  void report(Print &out) const;
+
+private:
+  // Raw samples, then the Q15 pairs decimated from them in place
+  uint16_t _buffer[2][LINE_IN_CAPTURE_SIZE];
+  SpectrumBands _bands;
+  int32_t _biasQ4 = 0;
+  uint32_t _sampleRateHz = 0;
+
+  uint32_t _frames = 0;
+  uint32_t _missed = 0;  // not polled before the next one was in
+  uint32_t _overrun = 0; // overwritten while being analyzed
+  uint32_t _lastCycles = 0;
+  uint32_t _maxCycles = 0;
+  uint32_t _rateStartMs = 0;
+  uint32_t _rateFrames = 0;
+  uint16_t _framesPerSecond = 0;
+};
@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+
+// Fixed-point spectrum of a block of ADC samples, split into the
+// visualizer's bands. Plain C++ without the Arduino core, so
+// tools/spectrumbench.cpp runs the same code on the host.
+//
+// The FFT is radix-2, decimation in time, on Q15 complex pairs, in place.
+// Every stage halves its outputs, so nothing overflows and the result is
+// the DFT divided by SPECTRUM_SIZE. For the Cortex-M3: butterflies are
+// 16x16->32 multiplies and shifts, the loops run twiddle-major so each
+// twiddle is loaded once per stage, and both the twiddles and the window
+// come from tables computed at compile time.
+
+#define SPECTRUM_LOG2_SIZE 8
+#define SPECTRUM_SIZE (1 << SPECTRUM_LOG2_SIZE)
+#define SPECTRUM_BANDS 16
+// Raw samples summed into one, raw 12-bit becomes 14-bit
+#define SPECTRUM_DECIMATION 4
+// Levels are log2 of the band's peak magnitude, from FLOOR (0) to TOP (255)
+#define SPECTRUM_FLOOR_LOG2 3
+#define SPECTRUM_TOP_LOG2 12
+// Level a band loses per frame when it gets quieter
+#define SPECTRUM_FALL 50
+// Captures the input's DC bias is averaged over
+#define SPECTRUM_BIAS_FRAMES 8
+
+// Decimates SPECTRUM_SIZE * SPECTRUM_DECIMATION raw 12-bit samples into
+// SPECTRUM_SIZE windowed Q15 complex pairs (imaginary 0), with the DC bias
+// removed. data may be raw itself: every pair is written behind the raw
+// samples still to be read.
+//
+// The bias is tracked across captures in biasQ4 (decimated units, Q4; 0
+// starts from this capture). One capture's own mean would take part of a
+// tone in the lowest bins with it, and the window spreads what is removed
+// into bin 1.
+void spectrumPrepare(int16_t *data, const uint16_t *raw, int32_t &biasQ4);
+
+// SPECTRUM_SIZE complex pairs, re and im interleaved
+void spectrumFft(int16_t *data);
+
+// |re + i im| within 7%, without a square root
+uint16_t spectrumMagnitude(int16_t re, int16_t im);
+
+// log2(x) in 1/8 steps, 0 for 0
+uint16_t spectrumLog2Q3(uint32_t x);
+
+class SpectrumBands {
+public:
+  // boundaries: SPECTRUM_BANDS + 1 lower band edges in Hz, the last closing
+  // the top band. A band narrower than a bin gets the bin of its centre.
+  void begin(uint32_t sampleRateHz, const uint16_t *boundaries);
+
+  // Band levels from an FFT result; a band falls by at most SPECTRUM_FALL
+  // from its previous level
+  void levels(const int16_t *fft, uint8_t *levels) const;
+
+  uint16_t firstBin(uint8_t band) const { return _first[band]; }
+  uint16_t lastBin(uint8_t band) const { return _last[band]; }
+
+private:
+  uint16_t _first[SPECTRUM_BANDS];
+  uint16_t _last[SPECTRUM_BANDS];
+};
@@ -0,0 +1,100 @@
+#include "LineInAnalyzer.h"
+
+#define LINE_IN_ADC ADC1
+// ADC1's request line
+#define LINE_IN_DMA DMA1_Channel1
+
+static_assert(LINE_IN_CAPTURE_SIZE * sizeof(uint16_t) >= SPECTRUM_SIZE * 2 * sizeof(int16_t),
+              "the decimated pairs are written over the raw capture");
+
+void LineInAnalyzer::begin(uint8_t channel, const uint16_t *boundaries) {
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_ADC1_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  __HAL_RCC_ADC_CONFIG(RCC_ADCPCLK2_DIV8);
+
+  // ADC12_IN0..7 are PA0..PA7
+  GPIO_InitTypeDef pin = {};
+  pin.Pin = 1 << channel;
+  pin.Mode = GPIO_MODE_ANALOG;
+  HAL_GPIO_Init(GPIOA, &pin);
+
+  LINE_IN_ADC->CR1 = 0;
+  LINE_IN_ADC->SMPR2 = LINE_IN_SAMPLE_TIME << (3 * channel);
+  LINE_IN_ADC->SQR1 = 0;
+  LINE_IN_ADC->SQR3 = channel;
+  LINE_IN_ADC->CR2 = ADC_CR2_ADON;
+  delayMicroseconds(2);
+  LINE_IN_ADC->CR2 |= ADC_CR2_CAL;
+  while (LINE_IN_ADC->CR2 & ADC_CR2_CAL) {
+  }
+
+  _sampleRateHz = HAL_RCC_GetPCLK2Freq() / LINE_IN_ADC_PRESCALER / LINE_IN_CONVERSION_CYCLES / SPECTRUM_DECIMATION;
+  _bands.begin(_sampleRateHz, boundaries);
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  // Converts from here on, the DMA wraps around both buffers
+  LINE_IN_DMA->CCR = 0;
+  LINE_IN_DMA->CPAR = (uint32_t)&LINE_IN_ADC->DR;
+  LINE_IN_DMA->CMAR = (uint32_t)_buffer;
+  LINE_IN_DMA->CNDTR = 2 * LINE_IN_CAPTURE_SIZE;
+  DMA1->IFCR = DMA_IFCR_CGIF1;
+  // 16-bit both sides, into memory
+  LINE_IN_DMA->CCR = DMA_CCR_MINC | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 | DMA_CCR_CIRC | DMA_CCR_EN;
+  LINE_IN_ADC->CR2 = ADC_CR2_ADON | ADC_CR2_CONT | ADC_CR2_DMA | ADC_CR2_EXTTRIG | ADC_CR2_EXTSEL;
+  LINE_IN_ADC->CR2 |= ADC_CR2_SWSTART;
+  _rateStartMs = millis();
+}
+
+bool LineInAnalyzer::update(uint8_t *levels) {
+  // Half transfer: the first buffer is full, transfer complete: the second
+  uint32_t done = DMA1->ISR & (DMA_ISR_HTIF1 | DMA_ISR_TCIF1);
+  if (done == 0)
+    return false;
+  DMA1->IFCR = done;
+  if (done == (DMA_ISR_HTIF1 | DMA_ISR_TCIF1))
+    _missed++;
+
+  // The buffer the DMA is not in holds the newest capture
+  uint8_t half = LINE_IN_DMA->CNDTR > LINE_IN_CAPTURE_SIZE ? 1 : 0;
+  uint32_t reentered = half ? DMA_ISR_HTIF1 : DMA_ISR_TCIF1;
+
+  uint32_t start = DWT->CYCCNT;
+  int16_t *data = (int16_t *)_buffer[half];
+  uint8_t fresh[SPECTRUM_BANDS];
+  memcpy(fresh, levels, sizeof(fresh));
+  spectrumPrepare(data, _buffer[half], _biasQ4);
+  spectrumFft(data);
+  _bands.levels(data, fresh);
+  _lastCycles = DWT->CYCCNT - start;
+  if (_lastCycles > _maxCycles)
+    _maxCycles = _lastCycles;
+
+  // The other buffer filled up meanwhile, so the DMA is writing over this one
+  if (DMA1->ISR & reentered) {
+    _overrun++;
+    return false;
+  }
+  memcpy(levels, fresh, sizeof(fresh));
+
+  _frames++;
+  _rateFrames++;
+  uint32_t elapsedMs = millis() - _rateStartMs;
+  if (elapsedMs >= 1000) {
+    _framesPerSecond = _rateFrames * 1000 / elapsedMs;
+    _rateFrames = 0;
+    _rateStartMs += elapsedMs;
+  }
+  return true;
+}
+
+void LineInAnalyzer::report(Print &out) const {
+  uint32_t mhz = SystemCoreClock / 1000000;
+  out.printf("line-in: %lu Hz, %u frames/s, %lu frames, %lu missed, %lu overrun, %lu cycles per frame (%lu us), "
+             "longest %lu\n",
+             (unsigned long)_sampleRateHz, _framesPerSecond, (unsigned long)_frames, (unsigned long)_missed,
+             (unsigned long)_overrun, (unsigned long)_lastCycles, (unsigned long)(_lastCycles / mhz),
+             (unsigned long)_maxCycles);
+}
@@ -0,0 +1,174 @@
+#include "Spectrum.h"
+
+namespace {
+
+constexpr double spectrumPi = 3.14159265358979323846;
+
+// |x| <= pi/2
+constexpr double taylorSin(double x) {
+  double term = x, sum = x;
+  for (int n = 1; n < 12; n++) {
+    term *= -x * x / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+// 0 <= x < 2 pi
+constexpr double tableSin(double x) {
+  if (x > spectrumPi)
+    return -tableSin(x - spectrumPi);
+  return taylorSin(x > spectrumPi / 2 ? spectrumPi - x : x);
+}
+
+constexpr int16_t q15(double x) {
+  double scaled = x * 32768.0;
+  scaled = scaled >= 0 ? scaled + 0.5 : scaled - 0.5;
+  return scaled > 32767 ? 32767 : scaled < -32768 ? -32768 : (int16_t)scaled;
+}
+
+struct SpectrumTables {
+  // sin(2 pi k / N); cos is a quarter turn further on
+  int16_t sine[SPECTRUM_SIZE * 3 / 4];
+  // Hann, symmetric about N/2
+  int16_t window[SPECTRUM_SIZE / 2 + 1];
+  int32_t windowSum;
+  uint8_t reverse[SPECTRUM_SIZE];
+
+  constexpr SpectrumTables() : sine(), window(), windowSum(0), reverse() {
+    for (int k = 0; k < SPECTRUM_SIZE * 3 / 4; k++)
+      sine[k] = q15(tableSin(2 * spectrumPi * k / SPECTRUM_SIZE));
+    for (int n = 0; n <= SPECTRUM_SIZE / 2; n++)
+      window[n] = q15(0.5 - 0.5 * tableSin(2 * spectrumPi * n / SPECTRUM_SIZE + spectrumPi / 2));
+    for (int n = 0; n < SPECTRUM_SIZE; n++)
+      windowSum += window[n <= SPECTRUM_SIZE / 2 ? n : SPECTRUM_SIZE - n];
+    for (int i = 0; i < SPECTRUM_SIZE; i++) {
+      int reversed = 0;
+      for (int bit = 0; bit < SPECTRUM_LOG2_SIZE; bit++)
+        reversed |= ((i >> bit) & 1) << (SPECTRUM_LOG2_SIZE - 1 - bit);
+      reverse[i] = reversed;
+    }
+  }
+};
+
+constexpr SpectrumTables spectrumTables;
+static_assert(SPECTRUM_SIZE <= 256, "the bit-reversal table holds bytes");
+static_assert(spectrumTables.sine[SPECTRUM_SIZE / 4] == 32767, "sin(pi/2) is full scale");
+static_assert(spectrumTables.window[0] == 0 && spectrumTables.window[SPECTRUM_SIZE / 2] == 32767,
+              "Hann window runs from 0 to 1");
+
+int32_t windowAt(uint16_t i) {
+  return spectrumTables.window[i <= SPECTRUM_SIZE / 2 ? i : SPECTRUM_SIZE - i];
+}
+
+} // namespace
+
+void spectrumPrepare(int16_t *data, const uint16_t *raw, int32_t &biasQ4) {
+  // Sums first, in place: pair i lands on raw samples 2i and 2i+1, which
+  // have been read by then. The mean is weighted by the window, so a bias
+  // that matches it leaves no DC to leak into the lowest bins.
+  int64_t weighted = 0;
+  for (uint16_t i = 0; i < SPECTRUM_SIZE; i++) {
+    int32_t sum = 0;
+    for (uint8_t k = 0; k < SPECTRUM_DECIMATION; k++)
+      sum += raw[i * SPECTRUM_DECIMATION + k];
+    weighted += (int64_t)sum * windowAt(i);
+    data[2 * i] = sum;
+    data[2 * i + 1] = 0;
+  }
+
+  int32_t meanQ4 = weighted * 16 / spectrumTables.windowSum;
+  if (biasQ4 == 0)
+    biasQ4 = meanQ4;
+  else
+    biasQ4 += (meanQ4 - biasQ4) / SPECTRUM_BIAS_FRAMES;
+
+  // 14-bit around the bias, doubled to Q15, then windowed
+  int32_t bias = (biasQ4 + 8) >> 4;
+  for (uint16_t i = 0; i < SPECTRUM_SIZE; i++)
+    data[2 * i] = ((data[2 * i] - bias) * 2 * windowAt(i)) >> 15;
+}
+
+void spectrumFft(int16_t *data) {
+  for (uint16_t i = 0; i < SPECTRUM_SIZE; i++) {
+    uint16_t j = spectrumTables.reverse[i];
+    if (i < j) {
+      int16_t re = data[2 * i], im = data[2 * i + 1];
+      data[2 * i] = data[2 * j];
+      data[2 * i + 1] = data[2 * j + 1];
+      data[2 * j] = re;
+      data[2 * j + 1] = im;
+    }
+  }
+
+  // Magnitudes never grow past the input's, so halving keeps every part
+  // within 16 bits
+  for (uint16_t half = 1, step = SPECTRUM_SIZE / 2; half < SPECTRUM_SIZE; half *= 2, step /= 2) {
+    for (uint16_t k = 0; k < half; k++) {
+      // W = e^(-2 pi i k / span)
+      int32_t wr = spectrumTables.sine[k * step + SPECTRUM_SIZE / 4];
+      int32_t wi = -spectrumTables.sine[k * step];
+      for (uint16_t i = k; i < SPECTRUM_SIZE; i += 2 * half) {
+        int16_t *a = data + 2 * i;
+        int16_t *b = a + 2 * half;
+        int32_t tr = (wr * b[0] - wi * b[1]) >> 15;
+        int32_t ti = (wr * b[1] + wi * b[0]) >> 15;
+        int32_t ar = a[0], ai = a[1];
+        a[0] = (ar + tr) >> 1;
+        a[1] = (ai + ti) >> 1;
+        b[0] = (ar - tr) >> 1;
+        b[1] = (ai - ti) >> 1;
+      }
+    }
+  }
+}
+
+uint16_t spectrumMagnitude(int16_t re, int16_t im) {
+  uint32_t x = re < 0 ? -re : re;
+  uint32_t y = im < 0 ? -im : im;
+  return x > y ? x + y * 3 / 8 : y + x * 3 / 8;
+}
+
+uint16_t spectrumLog2Q3(uint32_t x) {
+  if (x == 0)
+    return 0;
+  uint8_t bits = 31 - __builtin_clz(x);
+  uint32_t fraction = bits >= 3 ? x >> (bits - 3) : x << (3 - bits);
+  return bits * 8 + (fraction & 7);
+}
+
+void SpectrumBands::begin(uint32_t sampleRateHz, const uint16_t *boundaries) {
+  const uint32_t lastBin = SPECTRUM_SIZE / 2 - 1;
+  for (uint8_t band = 0; band < SPECTRUM_BANDS; band++) {
+    uint32_t low = boundaries[band], high = boundaries[band + 1];
+    uint32_t first = (low * SPECTRUM_SIZE + sampleRateHz - 1) / sampleRateHz;
+    uint32_t last = (high * SPECTRUM_SIZE + sampleRateHz - 1) / sampleRateHz - 1;
+    if (first < 1)
+      first = 1;
+    if (last > lastBin)
+      last = lastBin;
+    if (first > last) {
+      uint32_t centre = ((low + high) / 2 * SPECTRUM_SIZE + sampleRateHz / 2) / sampleRateHz;
+      first = last = centre < 1 ? 1 : centre > lastBin ? lastBin : centre;
+    }
+    _first[band] = first;
+    _last[band] = last;
+  }
+}
+
+void SpectrumBands::levels(const int16_t *fft, uint8_t *levels) const {
+  for (uint8_t band = 0; band < SPECTRUM_BANDS; band++) {
+    uint16_t peak = 0;
+    for (uint16_t bin = _first[band]; bin <= _last[band]; bin++) {
+      uint16_t magnitude = spectrumMagnitude(fft[2 * bin], fft[2 * bin + 1]);
+      if (magnitude > peak)
+        peak = magnitude;
+    }
+
+    int32_t level = ((int32_t)spectrumLog2Q3(peak) - SPECTRUM_FLOOR_LOG2 * 8) * 255 /
+                    ((SPECTRUM_TOP_LOG2 - SPECTRUM_FLOOR_LOG2) * 8);
+    level = level < 0 ? 0 : level > 255 ? 255 : level;
+    int32_t fallen = levels[band] - SPECTRUM_FALL;
+    levels[band] = level > fallen ? level : fallen < 0 ? 0 : fallen;
+  }
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <Arduino.h>
+
+// Binary telemetry over USART1 TX (D8/PA9), sent by DMA1 channel 4.
+//
+// Records are queued in a ring buffer and drained by DMA from service(), so
+// recording never waits on the UART. When the ring is full the record is
+// dropped and counted; the count goes out as a DROPPED record once there is
+// room again. Recording is interrupt-safe.
+//
+// Record: 0xA5, type, payload length, payload (little-endian), checksum
+// (bitwise-inverted 8-bit sum of type, length and payload). tools/telemetry.py
+// decodes the stream.
+
+#define TELEMETRY_BAUD 1000000
+#define TELEMETRY_BUFFER_SIZE 1024 // power of two
+#define TELEMETRY_SYNC 0xA5
+
+enum TelemetryType : uint8_t {
+  TELEMETRY_NOTE = 1,  // u8 song, u16 note, u32 scheduled us, u32 actual us
+  TELEMETRY_FRAME,     // u32 start us, u16 duration us
+  TELEMETRY_I2C,       // u8 address, u16 bytes, u16 wait us, u16 transfer us
+  TELEMETRY_INPUT,     // u8 input, i8 value, u32 time us
+  TELEMETRY_LOOP_RATE, // u16 loop iterations in the last second
+  TELEMETRY_DROPPED,   // u16 records dropped
+  TELEMETRY_LATENCY,   // u8 input, u32 input us, u16 audible, u16 handled, u32 note (us after input, 0 = n/a)
+};
+
+enum TelemetryInput : uint8_t {
+  TELEMETRY_INPUT_SKIP,
+  TELEMETRY_INPUT_SPEED,
+  TELEMETRY_INPUT_PAUSE,
+};
+
+class Telemetry {
+public:
+  void begin(uint32_t baud = TELEMETRY_BAUD);
+
+  // Each returns false if the record was dropped
+  bool note(uint8_t song, uint16_t note, uint32_t scheduledUs, uint32_t actualUs);
+  bool frame(uint32_t startUs, uint32_t durationUs);
+  bool i2c(uint8_t address, uint16_t bytes, uint32_t waitUs, uint32_t transferUs);
+  bool input(TelemetryInput input, int8_t value, uint32_t timeUs = micros());
+  bool latency(TelemetryInput input, uint32_t inputUs, uint32_t audibleUs, uint32_t handledUs, uint32_t noteUs);
+
+  // Counted here, sent as a LOOP_RATE record once per second by service()
+  void loopIteration() { _loops++; }
+
+  // Retires the finished DMA transfer and starts the next one
+  void service();
+
+  // Nothing on the line, so the baud rate may change
+  bool idle() const;
+  // Call with interrupts off after the APB2 clock changed
+  void clockChanged();
+
+  uint32_t dropped() const { return _dropped; }
+
+private:
+  bool push(TelemetryType type, const uint8_t *payload, uint8_t length);
+
+  bool _enabled = false;
+  uint32_t _baud = 0;
+  uint8_t _buffer[TELEMETRY_BUFFER_SIZE];
+  // Free-running, masked on access
+  uint16_t _head = 0;
+  uint16_t _tail = 0;
+  uint16_t _inFlight = 0;
+
+  uint32_t _dropped = 0;
+  uint32_t _droppedReported = 0;
+  uint16_t _loops = 0;
+  uint32_t _rateStartMs = 0;
+};
@@ -0,0 +1,173 @@
+#include "Telemetry.h"
+
+#define TELEMETRY_USART USART1
+#define TELEMETRY_DMA DMA1_Channel4
+
+// Sync, type, length and checksum around the payload
+#define TELEMETRY_OVERHEAD 4
+
+class IrqLock {
+public:
+  IrqLock() : _primask(__get_PRIMASK()) { __disable_irq(); }
+  ~IrqLock() { __set_PRIMASK(_primask); }
+
+private:
+  uint32_t _primask;
+};
+
+static uint8_t *putU16(uint8_t *p, uint16_t value) {
+  p[0] = value & 0xFF;
+  p[1] = value >> 8;
+  return p + 2;
+}
+
+static uint8_t *putU32(uint8_t *p, uint32_t value) {
+  return putU16(putU16(p, value & 0xFFFF), value >> 16);
+}
+
+static uint16_t saturate16(uint32_t value) {
+  return value > 0xFFFF ? 0xFFFF : value;
+}
+
+void Telemetry::begin(uint32_t baud) {
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_USART1_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  GPIO_InitTypeDef pin = {};
+  pin.Pin = GPIO_PIN_9;
+  pin.Mode = GPIO_MODE_AF_PP;
+  pin.Pull = GPIO_NOPULL;
+  pin.Speed = GPIO_SPEED_FREQ_HIGH;
+  HAL_GPIO_Init(GPIOA, &pin);
+
+  // USART1 is on APB2, transmit only, bytes come from DMA
+  TELEMETRY_USART->CR1 = 0;
+  _baud = baud;
+  TELEMETRY_USART->BRR = (HAL_RCC_GetPCLK2Freq() + baud / 2) / baud;
+  TELEMETRY_USART->CR3 = USART_CR3_DMAT;
+  TELEMETRY_USART->CR1 = USART_CR1_UE | USART_CR1_TE;
+
+  TELEMETRY_DMA->CCR = 0;
+  TELEMETRY_DMA->CPAR = (uint32_t)&TELEMETRY_USART->DR;
+
+  _head = _tail = _inFlight = 0;
+  _rateStartMs = millis();
+  _enabled = true;
+}
+
+bool Telemetry::push(TelemetryType type, const uint8_t *payload, uint8_t length) {
+  if (!_enabled)
+    return false;
+
+  IrqLock lock;
+  if (TELEMETRY_BUFFER_SIZE - (uint16_t)(_head - _tail) < length + TELEMETRY_OVERHEAD) {
+    _dropped++;
+    return false;
+  }
+
+  uint8_t sum = type + length;
+  _buffer[_head++ & (TELEMETRY_BUFFER_SIZE - 1)] = TELEMETRY_SYNC;
+  _buffer[_head++ & (TELEMETRY_BUFFER_SIZE - 1)] = type;
+  _buffer[_head++ & (TELEMETRY_BUFFER_SIZE - 1)] = length;
+  for (uint8_t i = 0; i < length; i++) {
+    sum += payload[i];
+    _buffer[_head++ & (TELEMETRY_BUFFER_SIZE - 1)] = payload[i];
+  }
+  _buffer[_head++ & (TELEMETRY_BUFFER_SIZE - 1)] = ~sum;
+  return true;
+}
+
+bool Telemetry::note(uint8_t song, uint16_t note, uint32_t scheduledUs, uint32_t actualUs) {
+  uint8_t payload[11];
+  payload[0] = song;
+  putU32(putU32(putU16(payload + 1, note), scheduledUs), actualUs);
+  return push(TELEMETRY_NOTE, payload, sizeof(payload));
+}
+
+bool Telemetry::frame(uint32_t startUs, uint32_t durationUs) {
+  uint8_t payload[6];
+  putU16(putU32(payload, startUs), saturate16(durationUs));
+  return push(TELEMETRY_FRAME, payload, sizeof(payload));
+}
+
+bool Telemetry::i2c(uint8_t address, uint16_t bytes, uint32_t waitUs, uint32_t transferUs) {
+  uint8_t payload[7];
+  payload[0] = address;
+  putU16(putU16(putU16(payload + 1, bytes), saturate16(waitUs)), saturate16(transferUs));
+  return push(TELEMETRY_I2C, payload, sizeof(payload));
+}
+
+bool Telemetry::input(TelemetryInput input, int8_t value, uint32_t timeUs) {
+  uint8_t payload[6];
+  payload[0] = input;
+  payload[1] = value;
+  putU32(payload + 2, timeUs);
+  return push(TELEMETRY_INPUT, payload, sizeof(payload));
+}
+
+bool Telemetry::latency(TelemetryInput input, uint32_t inputUs, uint32_t audibleUs, uint32_t handledUs,
+                        uint32_t noteUs) {
+  uint8_t payload[13];
+  payload[0] = input;
+  putU32(putU16(putU16(putU32(payload + 1, inputUs), saturate16(audibleUs)), saturate16(handledUs)), noteUs);
+  return push(TELEMETRY_LATENCY, payload, sizeof(payload));
+}
+
+void Telemetry::service() {
+  if (!_enabled)
+    return;
+
+  // CNDTR reaches zero once the last byte has been handed to the USART
+  if (_inFlight && TELEMETRY_DMA->CNDTR != 0)
+    return;
+
+  uint32_t now = millis();
+  if (now - _rateStartMs >= 1000) {
+    uint8_t payload[2];
+    putU16(payload, _loops);
+    push(TELEMETRY_LOOP_RATE, payload, sizeof(payload));
+    _loops = 0;
+    _rateStartMs = now;
+  }
+
+  uint16_t start, length;
+  {
+    IrqLock lock;
+    _tail += _inFlight;
+    _inFlight = 0;
+
+    uint32_t lost = _dropped - _droppedReported;
+    if (lost) {
+      uint8_t payload[2];
+      putU16(payload, saturate16(lost));
+      if (push(TELEMETRY_DROPPED, payload, sizeof(payload)))
+        _droppedReported += lost;
+      else
+        _dropped--; // still full, don't count the report itself
+    }
+
+    start = _tail & (TELEMETRY_BUFFER_SIZE - 1);
+    length = min((uint16_t)(_head - _tail), (uint16_t)(TELEMETRY_BUFFER_SIZE - start));
+  }
+  if (length == 0)
+    return;
+
+  // One contiguous run per transfer, the wrapped part goes next time
+  TELEMETRY_DMA->CCR = 0;
+  TELEMETRY_DMA->CMAR = (uint32_t)(_buffer + start);
+  TELEMETRY_DMA->CNDTR = length;
+  TELEMETRY_DMA->CCR = DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_EN;
+  _inFlight = length;
+}
+
+bool Telemetry::idle() const {
+  if (!_enabled)
+    return true;
+  return (!_inFlight || TELEMETRY_DMA->CNDTR == 0) && (TELEMETRY_USART->SR & USART_SR_TC);
+}
+
+void Telemetry::clockChanged() {
+  if (_enabled)
+    TELEMETRY_USART->BRR = (HAL_RCC_GetPCLK2Freq() + _baud / 2) / _baud;
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include <Arduino.h>
+
+// Buzzer tones in hardware: TIM2 channel 2 toggles D3 (PB3, with TIM2's
+// partial remap), so a note costs no CPU while it sounds. TIM4 ends it after
+// its duration, one interrupt per note.
+//
+// With TONE_VOICES 2, TIM1 channel 1 drives a second buzzer on D7 (PA8).
+// Both timers run from the same clock and playVoices() starts them in one
+// go, so the voices of a chord keep their phase to each other, and the one
+// TIM4 interrupt ends them together. TIM3 samples the inputs, so there is
+// no timer left for a third voice.
+//
+// With a single buzzer, TIM1 is free for chord mode instead: playChord()
+// switches the buzzer between the chord's tones TONE_ARPEGGIO_HZ times a
+// second, chiptune style. Each switch is a few register writes from a
+// precomputed table, timed with the cycle counter.
+//
+// Prescaler and reload for every pitch in pitches.h are computed at compile
+// time for TONE_TIMER_CLOCK_HZ and the slower clocks in TONE_TIMER_CLOCKS_HZ,
+// so starting a note is a table lookup and register writes, and so is
+// retuning the sounding notes when the CPU clock changes (clockChanged()).
+// Frequencies outside pitches.h, or another timer clock, fall back to
+// computing them.
+
+// TIM2 clock: 72 MHz SYSCLK, APB1 at 36 MHz, doubled for the timers. TIM1
+// gets the same from the undivided APB2.
+#define TONE_TIMER_CLOCK_HZ 72000000UL
+// Those of the clock profiles in ClockScaler.h, fastest first
+#define TONE_TIMER_CLOCKS_HZ TONE_TIMER_CLOCK_HZ, 36000000UL, 24000000UL, 8000000UL
+// Compile error if any pitch is further off than this at TONE_TIMER_CLOCK_HZ.
+// Slower clocks have coarser steps; exact() tells whether a pitch stays
+// within it there.
+#define TONE_TIMER_MAX_ERROR_PPM 50
+// Prescalers tried above the smallest that fits, for a closer reload
+#define TONE_TIMER_PSC_SEARCH 256
+// TIM4 ticks per ms while timing a note
+#define TONE_TIMER_STOP_TICKS_PER_MS 2
+// Buzzers, 1 or 2
+#define TONE_VOICES 2
+// For playVoices(): keep the voice's note sounding
+#define TONE_TIE 0xFFFF
+// Chord mode, only with one buzzer
+#define TONE_ARPEGGIO (TONE_VOICES == 1)
+#define TONE_ARPEGGIO_HZ 60
+#define TONE_ARPEGGIO_TONES 4
+
+struct ToneTimerSetting {
+  uint16_t frequency;
+  uint16_t psc;
+  uint16_t arr;
+  int32_t errorPpb; // played minus wanted frequency, parts per billion
+};
+
+// The output toggles on every update, so the update rate is twice the
+// frequency: clock / ((psc + 1) * (arr + 1)) = 2 * frequency.
+constexpr ToneTimerSetting toneTimerSetting(uint32_t clockHz, uint16_t frequency) {
+  ToneTimerSetting best = {frequency, 0, 0, 0};
+  if (frequency == 0)
+    return best;
+
+  uint64_t rate = 2ULL * frequency;
+  uint64_t period = (clockHz + rate / 2) / rate;
+  uint32_t firstPsc = (uint32_t)((period + 0xFFFF) / 0x10000);
+  firstPsc = firstPsc == 0 ? 0 : firstPsc - 1;
+  uint64_t bestError = ~0ULL;
+  for (uint32_t psc = firstPsc; psc <= 0xFFFF && psc < firstPsc + TONE_TIMER_PSC_SEARCH; psc++) {
+    uint64_t step = rate * (psc + 1);
+    uint64_t reload = (clockHz + step / 2) / step;
+    if (reload < 2 || reload > 0x10000)
+      continue;
+    uint64_t played = step * reload;
+    uint64_t error = played > clockHz ? played - clockHz : clockHz - played;
+    if (error < bestError) {
+      bestError = error;
+      best.psc = psc;
+      best.arr = reload - 1;
+    }
+    if (error == 0)
+      break;
+  }
+
+  // played / wanted - 1 = clock / (rate * (psc + 1) * (arr + 1)) - 1
+  uint64_t divisor = rate * (best.psc + 1) * (best.arr + 1);
+  int64_t difference = (int64_t)clockHz - (int64_t)divisor;
+  best.errorPpb = (int32_t)(difference * 1000000000LL / (int64_t)divisor);
+  return best;
+}
+
+class ToneTimer {
+public:
+  // Takes PB3 from JTAG, which the ST-Link's SWD does not need
+  void begin();
+
+  // Like tone(): replaces the current note, silent after durationMs. Other
+  // voices fall silent.
+  void play(uint16_t frequency, uint32_t durationMs);
+  // Starts a note on every voice at once. A frequency of 0 silences the
+  // voice, TONE_TIE leaves its note sounding without restarting it. Voices
+  // in sustainMask (bit per voice) sound on past durationMs, for a note tied
+  // into the next call.
+  void playVoices(const uint16_t frequencies[TONE_VOICES], uint32_t durationMs, uint8_t sustainMask = 0);
+  void stop();
+  // Moves the end of the sounding notes to durationMs from now, for tempo
+  // changes mid-note. Does nothing once they have ended.
+  void setRemaining(uint32_t durationMs);
+  bool sounding() const;
+#if TONE_ARPEGGIO
+  // Plays the first of count tones (up to TONE_ARPEGGIO_TONES) and cycles
+  // through them until the note ends
+  void playChord(const uint16_t *frequencies, uint8_t count, uint32_t durationMs);
+  // Tone switches so far and the longest, in CPU cycles
+  void reportArpeggio(Print &out) const;
+#endif
+
+  // Silences the sounding notes and resumes them with the time they had
+  // left. Safe to call from interrupts, which is where the pause button acts.
+  void hold();
+  void release();
+
+  // Call before a clock switch, with interrupts on: works out the sounding
+  // notes' settings at the new timer clock, lookups and any search outside
+  // the tables included, so clockChanged() only writes registers
+  void prepareClock(uint32_t clockHz);
+  // Call with interrupts off right after the timer clocks changed: the
+  // sounding notes go on at the same pitch and phase, and end on time. A
+  // clock prepareClock() was not told about gets table lookups only; a
+  // pitch outside the table then keeps its old setting until the next note.
+  void clockChanged();
+  // Whether the sounding notes, or frequency, are within
+  // TONE_TIMER_MAX_ERROR_PPM at a timer clock of clockHz
+  bool exactAt(uint32_t clockHz) const;
+  static bool exact(uint32_t clockHz, uint16_t frequency);
+
+  // The compile-time table, pitch codes in pitches.h order
+  static const ToneTimerSetting *table();
+  static uint8_t tableSize();
+  // Frequency, PSC, ARR and rounding error of every pitch
+  static void report(Print &out);
+
+private:
+  const ToneTimerSetting *lookup(uint8_t voice, uint16_t frequency) const;
+  ToneTimerSetting setting(uint8_t voice, uint16_t frequency) const;
+  const ToneTimerSetting *retuned(uint8_t voice, const ToneTimerSetting &prepared, uint16_t frequency) const;
+
+  uint32_t _clockHz[TONE_VOICES] = {};
+  uint32_t _preparedHz = 0;
+  ToneTimerSetting _prepared[TONE_VOICES] = {};
+#if TONE_ARPEGGIO
+  ToneTimerSetting _preparedArpeggio[TONE_ARPEGGIO_TONES] = {};
+#endif
+};
@@ -0,0 +1,469 @@
+#include "ToneTimer.h"
+#include "song_packed.h"
+
+#define TONE_TIMER_STOP TIM4
+
+namespace {
+
+struct ToneVoice {
+  TIM_TypeDef *timer;
+  uint32_t toggle;   // CCMR1 with the channel toggling
+  uint32_t inactive; // CCMR1 with the channel held low
+};
+
+// The channel's CCR stays 0, so toggling happens on every update
+const ToneVoice toneVoices[TONE_VOICES] = {
+    {TIM2, TIM_CCMR1_OC2M_0 | TIM_CCMR1_OC2M_1, TIM_CCMR1_OC2M_2},
+#if TONE_VOICES > 1
+    {TIM1, TIM_CCMR1_OC1M_0 | TIM_CCMR1_OC1M_1, TIM_CCMR1_OC1M_2},
+#endif
+};
+static_assert(TONE_VOICES >= 1 && TONE_VOICES <= 2, "TONE_VOICES is 1 or 2");
+
+constexpr uint16_t tonePitches[] = {SONG_PITCHES};
+constexpr uint8_t tonePitchCount = sizeof(tonePitches) / sizeof(tonePitches[0]);
+
+struct ToneTable {
+  uint32_t clockHz;
+  ToneTimerSetting settings[tonePitchCount];
+
+  constexpr ToneTable(uint32_t clock) : clockHz(clock), settings() {
+    for (uint8_t i = 0; i < tonePitchCount; i++)
+      settings[i] = toneTimerSetting(clock, tonePitches[i]);
+  }
+
+  constexpr int32_t worstErrorPpb() const {
+    int32_t worst = 0;
+    for (uint8_t i = 0; i < tonePitchCount; i++) {
+      int32_t error = settings[i].errorPpb < 0 ? -settings[i].errorPpb : settings[i].errorPpb;
+      worst = error > worst ? error : worst;
+    }
+    return worst;
+  }
+
+  // lookup() bisects, REST aside
+  constexpr bool ascending() const {
+    for (uint8_t i = 2; i < tonePitchCount; i++) {
+      if (settings[i].frequency <= settings[i - 1].frequency)
+        return false;
+    }
+    return true;
+  }
+};
+
+constexpr ToneTable toneTables[] = {TONE_TIMER_CLOCKS_HZ};
+constexpr const ToneTable &toneTable = toneTables[0];
+static_assert(toneTable.clockHz == TONE_TIMER_CLOCK_HZ, "TONE_TIMER_CLOCKS_HZ starts with TONE_TIMER_CLOCK_HZ");
+static_assert(toneTable.worstErrorPpb() <= TONE_TIMER_MAX_ERROR_PPM * 1000L,
+              "a pitch is off by more than TONE_TIMER_MAX_ERROR_PPM at TONE_TIMER_CLOCK_HZ");
+static_assert(toneTable.ascending(), "pitches.h is expected in ascending order");
+
+const ToneTable *findTable(uint32_t clockHz) {
+  for (const ToneTable &table : toneTables) {
+    if (table.clockHz == clockHz)
+      return &table;
+  }
+  return nullptr;
+}
+
+const ToneTimerSetting *findSetting(const ToneTable *table, uint16_t frequency) {
+  if (table == nullptr)
+    return nullptr;
+  uint8_t low = 1, high = tonePitchCount;
+  while (low < high) {
+    uint8_t mid = (low + high) / 2;
+    if (table->settings[mid].frequency < frequency)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  if (low < tonePitchCount && table->settings[low].frequency == frequency)
+    return &table->settings[low];
+  return nullptr;
+}
+
+class IrqLock {
+public:
+  IrqLock() : _primask(__get_PRIMASK()) { __disable_irq(); }
+  ~IrqLock() { __set_PRIMASK(_primask); }
+
+private:
+  uint32_t _primask;
+};
+
+HardwareTimer stopTimer(TONE_TIMER_STOP);
+volatile uint8_t toneSounding = 0;   // bit per voice
+volatile uint8_t toneSustained = 0;  // sounding on past the stop timer
+volatile bool toneTimed = false; // the stop timer is counting these notes
+volatile bool toneHeld = false;
+uint16_t toneFrequencies[TONE_VOICES]; // of the sounding notes
+
+#if TONE_ARPEGGIO
+HardwareTimer arpeggioTimer(TIM1);
+ToneTimerSetting arpeggioSettings[TONE_ARPEGGIO_TONES];
+uint16_t arpeggioFrequencies[TONE_ARPEGGIO_TONES];
+volatile uint8_t arpeggioCount = 0; // 0 or 1: no chord
+uint8_t arpeggioNext = 0;
+volatile uint32_t arpeggioSwitches = 0;
+volatile uint32_t arpeggioMaxCycles = 0;
+
+// Bounded: no lookups, three timer writes and the bookkeeping
+void onArpeggioTimer() {
+  uint32_t start = DWT->CYCCNT;
+  if (arpeggioCount < 2 || !toneSounding || toneHeld)
+    return;
+  const ToneTimerSetting &setting = arpeggioSettings[arpeggioNext];
+  arpeggioNext = arpeggioNext + 1 < arpeggioCount ? arpeggioNext + 1 : 0;
+  TIM_TypeDef *timer = toneVoices[0].timer;
+  timer->PSC = setting.psc;
+  timer->ARR = setting.arr;
+  timer->EGR = TIM_EGR_UG;
+
+  uint32_t cycles = DWT->CYCCNT - start;
+  arpeggioSwitches++;
+  if (cycles > arpeggioMaxCycles)
+    arpeggioMaxCycles = cycles;
+}
+#endif
+
+void setOutputs(uint8_t voices, bool on) {
+  for (uint8_t i = 0; i < TONE_VOICES; i++) {
+    if (voices & (1 << i))
+      toneVoices[i].timer->CCMR1 = on ? toneVoices[i].toggle : toneVoices[i].inactive;
+  }
+}
+
+void endNotes() {
+  uint8_t ending = toneSounding & ~toneSustained;
+  setOutputs(ending, false);
+  stopTimer.pause();
+  toneSounding &= ~ending;
+  toneTimed = false;
+#if TONE_ARPEGGIO
+  arpeggioCount = 0;
+#endif
+}
+
+void onStopTimer() {
+  endNotes();
+}
+
+void startStopTimer(uint32_t durationMs) {
+  uint32_t ticks = durationMs * TONE_TIMER_STOP_TICKS_PER_MS;
+  toneTimed = true;
+  stopTimer.pause();
+  stopTimer.setOverflow(ticks < 0x10000 ? ticks : 0x10000, TICK_FORMAT);
+  stopTimer.refresh();
+  stopTimer.resume();
+}
+
+} // namespace
+
+// The channel is set up held low, with the counter running
+static void startVoice(const ToneVoice &voice, uint32_t enable) {
+  voice.timer->CR1 = 0;
+  voice.timer->CCMR1 = voice.inactive;
+  voice.timer->CCR1 = 0;
+  voice.timer->CCR2 = 0;
+  voice.timer->CCER = enable;
+  voice.timer->CR1 = TIM_CR1_CEN;
+}
+
+// Timers run at twice the bus clock unless the bus is undivided
+static uint32_t timerClock(uint32_t pclk) {
+  return pclk == HAL_RCC_GetHCLKFreq() ? pclk : pclk * 2;
+}
+
+void ToneTimer::begin() {
+  __HAL_RCC_AFIO_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_TIM2_CLK_ENABLE();
+  __HAL_AFIO_REMAP_SWJ_NOJTAG();
+  __HAL_AFIO_REMAP_TIM2_PARTIAL_1();
+
+  GPIO_InitTypeDef pin = {};
+  pin.Pin = GPIO_PIN_3;
+  pin.Mode = GPIO_MODE_AF_PP;
+  pin.Pull = GPIO_NOPULL;
+  pin.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(GPIOB, &pin);
+
+  _clockHz[0] = timerClock(HAL_RCC_GetPCLK1Freq());
+  startVoice(toneVoices[0], TIM_CCER_CC2E);
+
+#if TONE_VOICES > 1
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_TIM1_CLK_ENABLE();
+  pin.Pin = GPIO_PIN_8;
+  HAL_GPIO_Init(GPIOA, &pin);
+
+  _clockHz[1] = timerClock(HAL_RCC_GetPCLK2Freq());
+  // An advanced timer keeps its outputs off until MOE is set
+  TIM1->BDTR = TIM_BDTR_MOE;
+  startVoice(toneVoices[1], TIM_CCER_CC1E);
+#endif
+
+#if TONE_ARPEGGIO
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  // Runs all along, idle between chords
+  arpeggioTimer.setOverflow(TONE_ARPEGGIO_HZ, HERTZ_FORMAT);
+  arpeggioTimer.attachInterrupt(onArpeggioTimer);
+  arpeggioTimer.resume();
+#endif
+
+  // TIM4 is on APB1 like TIM2
+  stopTimer.setPrescaleFactor(_clockHz[0] / (1000 * TONE_TIMER_STOP_TICKS_PER_MS));
+  stopTimer.setOverflow(0x10000, TICK_FORMAT);
+  stopTimer.attachInterrupt(onStopTimer);
+}
+
+const ToneTimerSetting *ToneTimer::lookup(uint8_t voice, uint16_t frequency) const {
+  return findSetting(findTable(_clockHz[voice]), frequency);
+}
+
+// The table's setting, or one computed for a pitch or clock it lacks
+static ToneTimerSetting settingAt(uint32_t clockHz, uint16_t frequency) {
+  const ToneTimerSetting *found = findSetting(findTable(clockHz), frequency);
+  return found != nullptr ? *found : toneTimerSetting(clockHz, frequency);
+}
+
+ToneTimerSetting ToneTimer::setting(uint8_t voice, uint16_t frequency) const {
+  return settingAt(_clockHz[voice], frequency);
+}
+
+void ToneTimer::play(uint16_t frequency, uint32_t durationMs) {
+  if (frequency == 0) {
+    stop();
+    return;
+  }
+  uint16_t frequencies[TONE_VOICES] = {frequency};
+  playVoices(frequencies, durationMs);
+}
+
+void ToneTimer::playVoices(const uint16_t frequencies[TONE_VOICES], uint32_t durationMs, uint8_t sustainMask) {
+  // Worked out before the lock, a pitch outside the table takes a while
+  ToneTimerSetting settings[TONE_VOICES];
+  uint8_t starting = 0, tied = 0;
+  for (uint8_t i = 0; i < TONE_VOICES; i++) {
+    if (frequencies[i] == TONE_TIE) {
+      tied |= 1 << i;
+    } else if (frequencies[i] != 0) {
+      settings[i] = setting(i, frequencies[i]);
+      starting |= 1 << i;
+    }
+  }
+
+  IrqLock lock;
+  stopTimer.pause();
+  toneTimed = false;
+  toneHeld = false;
+#if TONE_ARPEGGIO
+  if (!(tied & 1))
+    arpeggioCount = 0;
+#endif
+  tied &= toneSounding;
+  setOutputs(~(starting | tied), false);
+  for (uint8_t i = 0; i < TONE_VOICES; i++) {
+    if (starting & (1 << i)) {
+      toneVoices[i].timer->PSC = settings[i].psc;
+      toneVoices[i].timer->ARR = settings[i].arr;
+      toneFrequencies[i] = frequencies[i];
+    }
+  }
+  // The prescaler is buffered, the update event loads it now and restarts
+  // the period instead of finishing the old note's. Back to back, so the
+  // voices start within a few cycles of each other.
+  for (uint8_t i = 0; i < TONE_VOICES; i++) {
+    if (starting & (1 << i))
+      toneVoices[i].timer->EGR = TIM_EGR_UG;
+  }
+  // A tied voice may have been held
+  setOutputs(starting | tied, true);
+  toneSounding = starting | tied;
+  toneSustained = toneSounding & sustainMask;
+
+  // 0 plays until stop(), like tone()
+  if (durationMs != 0 && (toneSounding & ~toneSustained))
+    startStopTimer(durationMs);
+}
+
+#if TONE_ARPEGGIO
+void ToneTimer::playChord(const uint16_t *frequencies, uint8_t count, uint32_t durationMs) {
+  if (count > TONE_ARPEGGIO_TONES)
+    count = TONE_ARPEGGIO_TONES;
+  ToneTimerSetting settings[TONE_ARPEGGIO_TONES];
+  for (uint8_t i = 0; i < count; i++)
+    settings[i] = setting(0, frequencies[i]);
+
+  IrqLock lock;
+  playVoices(frequencies, durationMs);
+  if (!toneSounding)
+    return;
+  memcpy(arpeggioSettings, settings, count * sizeof(settings[0]));
+  memcpy(arpeggioFrequencies, frequencies, count * sizeof(frequencies[0]));
+  arpeggioNext = count > 1 ? 1 : 0;
+  arpeggioCount = count;
+  // A full slot for the first tone, without the update event's interrupt
+  TIM1->CNT = 0;
+}
+
+void ToneTimer::reportArpeggio(Print &out) const {
+  uint32_t maxCycles = arpeggioMaxCycles;
+  out.printf("arpeggio: %lu switches at %u Hz, longest %lu cycles (%lu ns)\n", (unsigned long)arpeggioSwitches,
+             TONE_ARPEGGIO_HZ, (unsigned long)maxCycles, (unsigned long)(maxCycles * 1000ULL / (SystemCoreClock / 1000000)));
+}
+#endif
+
+void ToneTimer::stop() {
+  IrqLock lock;
+  stopTimer.pause();
+  setOutputs(toneSounding, false);
+  toneSounding = 0;
+  toneSustained = 0;
+#if TONE_ARPEGGIO
+  arpeggioCount = 0;
+#endif
+  toneTimed = false;
+  toneHeld = false;
+}
+
+void ToneTimer::setRemaining(uint32_t durationMs) {
+  IrqLock lock;
+  if (!(toneSounding & ~toneSustained) || toneHeld)
+    return;
+  if (durationMs == 0)
+    endNotes();
+  else
+    startStopTimer(durationMs);
+}
+
+void ToneTimer::hold() {
+  IrqLock lock;
+  if (!toneSounding || toneHeld)
+    return;
+  stopTimer.pause();
+  setOutputs(toneSounding, false);
+  toneHeld = true;
+}
+
+void ToneTimer::release() {
+  IrqLock lock;
+  if (!toneHeld)
+    return;
+  toneHeld = false;
+  setOutputs(toneSounding, true);
+  // Counts on from where hold() stopped it
+  if (toneTimed)
+    stopTimer.resume();
+}
+
+bool ToneTimer::sounding() const {
+  return toneSounding != 0;
+}
+
+void ToneTimer::prepareClock(uint32_t clockHz) {
+  // Every profile clocks both timers at HCLK
+  for (uint8_t i = 0; i < TONE_VOICES; i++)
+    _prepared[i] = settingAt(clockHz, toneFrequencies[i]);
+#if TONE_ARPEGGIO
+  for (uint8_t i = 0; i < arpeggioCount; i++)
+    _preparedArpeggio[i] = settingAt(clockHz, arpeggioFrequencies[i]);
+#endif
+  _preparedHz = clockHz;
+}
+
+// What prepareClock() worked out, or the table's setting if the clock or
+// the note is another one by now
+const ToneTimerSetting *ToneTimer::retuned(uint8_t voice, const ToneTimerSetting &prepared,
+                                           uint16_t frequency) const {
+  if (_preparedHz == _clockHz[voice] && prepared.frequency == frequency)
+    return &prepared;
+  return lookup(voice, frequency);
+}
+
+void ToneTimer::clockChanged() {
+  IrqLock lock;
+  _clockHz[0] = timerClock(HAL_RCC_GetPCLK1Freq());
+#if TONE_VOICES > 1
+  _clockHz[1] = timerClock(HAL_RCC_GetPCLK2Freq());
+#endif
+
+  // The update event loads the buffered prescaler; the counter is then put
+  // back to the same point of the period. The tone timers have no update
+  // interrupt, so nothing else sees the event.
+  for (uint8_t i = 0; i < TONE_VOICES; i++) {
+    if (!(toneSounding & (1 << i)))
+      continue;
+    const ToneTimerSetting *to = retuned(i, _prepared[i], toneFrequencies[i]);
+    if (to == nullptr)
+      continue;
+    TIM_TypeDef *timer = toneVoices[i].timer;
+    uint32_t position = timer->CNT * (to->arr + 1) / (timer->ARR + 1);
+    timer->PSC = to->psc;
+    timer->ARR = to->arr;
+    timer->EGR = TIM_EGR_UG;
+    timer->CNT = position;
+  }
+
+#if TONE_ARPEGGIO
+  for (uint8_t i = 0; i < arpeggioCount; i++) {
+    const ToneTimerSetting *to = retuned(0, _preparedArpeggio[i], arpeggioFrequencies[i]);
+    if (to != nullptr)
+      arpeggioSettings[i] = *to;
+  }
+  arpeggioTimer.setOverflow(TONE_ARPEGGIO_HZ, HERTZ_FORMAT);
+#endif
+
+  // The same for the stop timer's ticks, with URS set so the event does not
+  // end the notes. Only the tick in progress is lost, under 1 / TICKS_PER_MS.
+  TIM_TypeDef *stop = TONE_TIMER_STOP;
+  uint32_t count = stop->CNT;
+  uint32_t control = stop->CR1;
+  stop->PSC = _clockHz[0] / (1000 * TONE_TIMER_STOP_TICKS_PER_MS) - 1;
+  stop->CR1 = control | TIM_CR1_URS;
+  stop->EGR = TIM_EGR_UG;
+  stop->CNT = count;
+  stop->CR1 = control;
+}
+
+bool ToneTimer::exact(uint32_t clockHz, uint16_t frequency) {
+  const ToneTimerSetting *found = findSetting(findTable(clockHz), frequency);
+  if (found == nullptr)
+    return frequency == 0;
+  int32_t error = found->errorPpb < 0 ? -found->errorPpb : found->errorPpb;
+  return error <= TONE_TIMER_MAX_ERROR_PPM * 1000L;
+}
+
+bool ToneTimer::exactAt(uint32_t clockHz) const {
+  for (uint8_t i = 0; i < TONE_VOICES; i++) {
+    if ((toneSounding & (1 << i)) && !exact(clockHz, toneFrequencies[i]))
+      return false;
+  }
+#if TONE_ARPEGGIO
+  for (uint8_t i = 0; i < arpeggioCount; i++) {
+    if (!exact(clockHz, arpeggioFrequencies[i]))
+      return false;
+  }
+#endif
+  return true;
+}
+
+const ToneTimerSetting *ToneTimer::table() {
+  return toneTable.settings;
+}
+
+uint8_t ToneTimer::tableSize() {
+  return tonePitchCount;
+}
+
+void ToneTimer::report(Print &out) {
+  for (const ToneTable &table : toneTables)
+    out.printf("tone: %lu Hz timer clock, worst error %ld ppb\n", (unsigned long)table.clockHz,
+               (long)table.worstErrorPpb());
+  for (uint8_t i = 1; i < tonePitchCount; i++) {
+    const ToneTimerSetting &setting = toneTable.settings[i];
+    out.printf("tone: %4u Hz  psc %5u  arr %5u  %+ld ppb\n", setting.frequency, setting.psc, setting.arr,
+               (long)setting.errorPpb);
+  }
+}
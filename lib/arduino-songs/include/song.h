@@ -1,8 +1,28 @@
 #pragma once
+#include <stdint.h>
+
+// Marks a track voice that keeps the previous note sounding
+#define SONG_TIE (-1)
+
+// Voices played under the melody on further buzzers. They move in rows, one
+// per melody note: row i holds each voice's pitch for the length of note i,
+// so every voice changes together with the melody. A player with fewer
+// buzzers than voices can play a row as a chord instead.
+struct SongTracks {
+    uint8_t voices;
+    // voices frequencies per row, 0 for a rest, SONG_TIE to hold
+    const int* rows;
+    // Pitch codes instead (see song_packed.h), used instead of rows when set
+    const uint8_t* packedRows;
+};
 
 struct Song {
     const char* name;
     const int* melody;
     unsigned int length;
     unsigned int tempo;
+    // Compressed notes (see song_packed.h), used instead of melody when set
+    const uint8_t* packed;
+    // Voices under the melody, nullptr for a melody alone
+    const SongTracks* tracks;
 };
@@ -0,0 +1,52 @@
+#pragma once
+#include "pitches.h"
+#include "song.h"
+
+// Compressed melodies, generated by tools/pack_songs.py.
+//
+// A packed melody is a stream of tokens:
+//   literal    pitch code (< 0x80), divider as int8
+//   reference  0x80 | (count - 1), u16 distance (little-endian)
+// A reference repeats count literal notes starting distance bytes before the
+// reference itself. References only ever point at literals, so a cursor
+// needs no stack to decode them.
+
+#define SONG_PACKED_REFERENCE 0x80
+// SONG_TIE in packed track rows
+#define SONG_PACKED_TIE 0xFF
+
+// Pitch codes in pitches.h order, for tables indexed by code
+#define SONG_PITCHES \
+    REST, NOTE_B0, NOTE_C1, NOTE_CS1, NOTE_D1, NOTE_DS1, NOTE_E1, NOTE_F1, \
+    NOTE_FS1, NOTE_G1, NOTE_GS1, NOTE_A1, NOTE_AS1, NOTE_B1, NOTE_C2, NOTE_CS2, \
+    NOTE_D2, NOTE_DS2, NOTE_E2, NOTE_F2, NOTE_FS2, NOTE_G2, NOTE_GS2, NOTE_A2, \
+    NOTE_AS2, NOTE_B2, NOTE_C3, NOTE_CS3, NOTE_D3, NOTE_DS3, NOTE_E3, NOTE_F3, \
+    NOTE_FS3, NOTE_G3, NOTE_GS3, NOTE_A3, NOTE_AS3, NOTE_B3, NOTE_C4, NOTE_CS4, \
+    NOTE_D4, NOTE_DS4, NOTE_E4, NOTE_F4, NOTE_FS4, NOTE_G4, NOTE_GS4, NOTE_A4, \
+    NOTE_AS4, NOTE_B4, NOTE_C5, NOTE_CS5, NOTE_D5, NOTE_DS5, NOTE_E5, NOTE_F5, \
+    NOTE_FS5, NOTE_G5, NOTE_GS5, NOTE_A5, NOTE_AS5, NOTE_B5, NOTE_C6, NOTE_CS6, \
+    NOTE_D6, NOTE_DS6, NOTE_E6, NOTE_F6, NOTE_FS6, NOTE_G6, NOTE_GS6, NOTE_A6, \
+    NOTE_AS6, NOTE_B6, NOTE_C7, NOTE_CS7, NOTE_D7, NOTE_DS7, NOTE_E7, NOTE_F7, \
+    NOTE_FS7, NOTE_G7, NOTE_GS7, NOTE_A7, NOTE_AS7, NOTE_B7, NOTE_C8, NOTE_CS8, \
+    NOTE_D8, NOTE_DS8
+
+// Frequencies of the pitch codes, in pitches.h order
+extern const uint16_t song_pitch_table[];
+
+// Walks the notes of a packed or plain song
+struct SongCursor {
+    const Song* song;
+    unsigned int note;
+    uint16_t position;
+    uint16_t refPosition;
+    uint8_t refRemaining;
+};
+
+void songCursorBegin(SongCursor& cursor, const Song& song, unsigned int startNote = 0);
+bool songCursorNext(SongCursor& cursor, int& frequency, int& divider);
+
+// Track voice pitch at a melody note, 0 for a rest. A tie is followed back
+// to the note that started it.
+uint16_t songTrackPitch(const Song& song, unsigned int note, uint8_t voice);
+// Whether the voice holds its previous note through this one
+bool songTrackTied(const Song& song, unsigned int note, uint8_t voice);
@@ -0,0 +1,20 @@
+// Generated by tools/pack_songs.py from the song sources, do not edit.
+#pragma once
+#include <stdint.h>
+
+// Per-song metadata, in all_songs[] order
+struct SongInfo {
+    uint32_t durationMs;        // at 1.0x
+    uint16_t length;            // notes
+    uint16_t lowestFrequency;   // rests excluded
+    uint16_t highestFrequency;
+    uint16_t bandMask;          // visualizer bands the song reaches
+};
+
+// Longest melody, the most notes any per-song buffer has to hold
+#define SONG_TOC_MAX_LENGTH 680
+#define SONG_TOC_BANDS 16
+
+extern const SongInfo song_toc[];
+// Lower band edges in Hz, the last entry closes the top band
+extern const uint16_t song_band_boundaries[SONG_TOC_BANDS + 1];
@@ -17,9 +17,27 @@ static const int happybirthday_melody[] = {
   NOTE_F4,-2,
 };
 
+// Bass line, one entry per melody note
+static const int happybirthday_rows[] = {
+  0, 0,
+  NOTE_F3, SONG_TIE, SONG_TIE,
+  NOTE_C3, SONG_TIE, SONG_TIE,
+  NOTE_C3, NOTE_E3, NOTE_G3,
+  NOTE_F3, SONG_TIE, SONG_TIE,
+
+  NOTE_F3, NOTE_A3, NOTE_C4,
+  NOTE_AS2, SONG_TIE, SONG_TIE, SONG_TIE,
+  NOTE_C3, SONG_TIE, NOTE_E3,
+  NOTE_F3,
+};
+
+static const SongTracks happybirthday_tracks = {1, happybirthday_rows, nullptr};
+
 const Song happybirthday_song = {
     "Happybirthday",
     happybirthday_melody,
     sizeof(happybirthday_melody) / sizeof(happybirthday_melody[0]) / 2,
-    140
+    140,
+    nullptr,
+    &happybirthday_tracks
 };
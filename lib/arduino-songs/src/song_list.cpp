@@ -1,3 +1,5 @@
+// Plain melodies; the default build uses song_list_packed.cpp instead
+#if !SONG_BANK_PACKED
 #include "song_list.h"
 #include "miichannel.h"
 #include "songofstorms.h"
@@ -86,3 +88,4 @@ const Song* all_songs[] = {
 };
 
 const unsigned int song_count = sizeof(all_songs) / sizeof(all_songs[0]);
+#endif
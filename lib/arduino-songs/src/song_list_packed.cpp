@@ -0,0 +1,839 @@
+// Generated by tools/pack_songs.py from the song sources, do not edit.
+#if SONG_BANK_PACKED
+#include "song_list.h"
+
+// Miichannel: 286 notes, 2288 -> 365 bytes
+static const uint8_t miichannel_packed[] = {
+    0x2C, 0x08, 0x00, 0x08, 0x2F, 0x08, 0x33, 0x08, 0x81, 0x06, 0x00, 0x00, 0x08, 0x2C, 0x08, 0x28,
+    0x08, 0x28, 0x08, 0x28, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x27, 0x08, 0x28, 0x08, 0x2C,
+    0x08, 0x81, 0x1D, 0x00, 0x81, 0x22, 0x00, 0x00, 0x08, 0x2B, 0x08, 0x36, 0xFC, 0x35, 0x08, 0x34,
+    0x08, 0x81, 0x1C, 0x00, 0x2E, 0x08, 0x00, 0x08, 0x33, 0x08, 0x81, 0x3A, 0x00, 0x33, 0x08, 0x00,
+    0x08, 0x82, 0x0D, 0x00, 0x2D, 0x08, 0x81, 0x46, 0x00, 0x2A, 0x08, 0x00, 0x08, 0x2A, 0x08, 0x2A,
+    0x08, 0x81, 0x08, 0x00, 0x00, 0x04, 0x81, 0x09, 0x00, 0x81, 0x10, 0x00, 0x00, 0x04, 0x29, 0x08,
+    0x28, 0x08, 0x27, 0x08, 0x82, 0x62, 0x00, 0x81, 0x65, 0x00, 0x85, 0x5F, 0x00, 0x36, 0x08, 0x36,
+    0x08, 0x36, 0x08, 0x00, 0x08, 0x81, 0x6A, 0x00, 0x81, 0x74, 0x00, 0x81, 0x79, 0x00, 0x81, 0x57,
+    0x00, 0x36, 0x02, 0x34, 0x08, 0x81, 0x70, 0x00, 0x31, 0x08, 0x2D, 0x08, 0x28, 0x08, 0x27, 0x04,
+    0x81, 0x08, 0x00, 0x27, 0x08, 0x2F, 0x08, 0x2C, 0x08, 0x26, 0x08, 0x25, 0x04, 0x2B, 0x08, 0x28,
+    0x08, 0x25, 0x08, 0x81, 0x56, 0x00, 0x2A, 0x08, 0x00, 0x04, 0x00, 0x04, 0x30, 0x04, 0x33, 0x08,
+    0x34, 0x08, 0x38, 0x08, 0x3B, 0x08, 0x81, 0xA1, 0x00, 0x00, 0x02, 0x23, 0x04, 0x24, 0x04, 0x23,
+    0xFC, 0x23, 0x08, 0x23, 0x02, 0x00, 0x04, 0x23, 0x08, 0x24, 0x08, 0x23, 0x08, 0x2B, 0x04, 0x26,
+    0x08, 0x82, 0x12, 0x00, 0x00, 0x02, 0x25, 0x04, 0x26, 0x04, 0x27, 0xFC, 0x26, 0x08, 0x27, 0x02,
+    0x00, 0x04, 0x27, 0x08, 0x26, 0x08, 0x27, 0x08, 0x2E, 0x04, 0x29, 0x08, 0x27, 0xFC, 0x29, 0x08,
+    0x25, 0x01, 0x2A, 0x04, 0x2A, 0x04, 0x2A, 0x04, 0x81, 0xED, 0x00, 0x82, 0xF9, 0x00, 0x81, 0xFC,
+    0x00, 0x8A, 0xF6, 0x00, 0x81, 0x00, 0x01, 0x81, 0x05, 0x01, 0x84, 0xE3, 0x00, 0x81, 0xF8, 0x00,
+    0x82, 0xDC, 0x00, 0x81, 0x13, 0x01, 0x81, 0xD9, 0x00, 0x82, 0xE5, 0x00, 0x2D, 0x08, 0x81, 0x1E,
+    0x01, 0x83, 0xD8, 0x00, 0x81, 0xDB, 0x00, 0x00, 0x04, 0x81, 0xDC, 0x00, 0x81, 0xE3, 0x00, 0x83,
+    0xD3, 0x00, 0x82, 0x30, 0x01, 0x81, 0x33, 0x01, 0x85, 0x2D, 0x01, 0x83, 0xCE, 0x00, 0x81, 0x33,
+    0x01, 0x81, 0x3D, 0x01, 0x81, 0x42, 0x01, 0x81, 0x20, 0x01, 0x81, 0xC9, 0x00, 0x81, 0x38, 0x01,
+    0x83, 0xC8, 0x00, 0x81, 0xCB, 0x00, 0x87, 0xC3, 0x00, 0x81, 0x0C, 0x01, 0x87, 0xB6, 0x00, 0x81,
+    0x4A, 0x01, 0x8B, 0xA9, 0x00, 0x82, 0xA6, 0x00, 0x91, 0x94, 0x00, 0x00, 0x08,
+};
+static const Song miichannel_packed_song = {"Miichannel", nullptr, 286, 114, miichannel_packed};
+
+// Songofstorms: 67 notes, 536 -> 79 bytes
+static const uint8_t songofstorms_packed[] = {
+    0x28, 0x04, 0x2F, 0x04, 0x2F, 0x04, 0x00, 0x08, 0x2A, 0x08, 0x31, 0x02, 0x2B, 0x04, 0x32, 0x04,
+    0x32, 0x04, 0x82, 0x0C, 0x00, 0x88, 0x15, 0x00, 0x82, 0x12, 0x00, 0x28, 0x08, 0x2B, 0x08, 0x34,
+    0x02, 0x82, 0x06, 0x00, 0x36, 0xFC, 0x37, 0x08, 0x36, 0x08, 0x36, 0x08, 0x36, 0x08, 0x32, 0x08,
+    0x2F, 0x02, 0x2F, 0x04, 0x28, 0x04, 0x2B, 0x08, 0x2D, 0x08, 0x2F, 0xFE, 0x83, 0x0A, 0x00, 0x2A,
+    0xFE, 0x82, 0x26, 0x00, 0x82, 0x29, 0x00, 0x8A, 0x23, 0x00, 0x81, 0x1A, 0x00, 0x28, 0x01,
+};
+static const Song songofstorms_packed_song = {"Songofstorms", nullptr, 67, 108, songofstorms_packed};
+
+// Nokia: 13 notes, 104 -> 26 bytes
+static const uint8_t nokia_packed[] = {
+    0x36, 0x08, 0x34, 0x08, 0x2C, 0x04, 0x2E, 0x04, 0x33, 0x08, 0x31, 0x08, 0x28, 0x04, 0x2A, 0x04,
+    0x31, 0x08, 0x2F, 0x08, 0x27, 0x04, 0x2A, 0x04, 0x2F, 0x02,
+};
+static const Song nokia_packed_song = {"Nokia", nullptr, 13, 180, nokia_packed};
+
+// Keyboardcat: 60 notes, 480 -> 80 bytes
+static const uint8_t keyboardcat_packed[] = {
+    0x00, 0x01, 0x00, 0x01, 0x26, 0x04, 0x2A, 0x04, 0x2D, 0x04, 0x2A, 0x04, 0x26, 0x04, 0x2A, 0x08,
+    0x2D, 0xFC, 0x2A, 0x04, 0x23, 0x04, 0x81, 0x12, 0x00, 0x26, 0x04, 0x23, 0x04, 0x26, 0x08, 0x2A,
+    0xFC, 0x26, 0x04, 0x21, 0x04, 0x25, 0x04, 0x28, 0x04, 0x25, 0x04, 0x21, 0x04, 0x25, 0x08, 0x28,
+    0xFC, 0x81, 0x08, 0x00, 0x21, 0x08, 0x21, 0xFC, 0x21, 0x08, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,
+    0x81, 0x08, 0x00, 0x88, 0x3F, 0x00, 0x81, 0x42, 0x00, 0x8B, 0x30, 0x00, 0x25, 0x04, 0x21, 0xFF,
+};
+static const Song keyboardcat_packed_song = {"Keyboardcat", nullptr, 60, 160, keyboardcat_packed};
+
+// Minuetg: 190 notes, 1520 -> 229 bytes
+static const uint8_t minuetg_packed[] = {
+    0x34, 0x04, 0x2D, 0x08, 0x2F, 0x08, 0x31, 0x08, 0x32, 0x08, 0x34, 0x04, 0x2D, 0x04, 0x2D, 0x04,
+    0x36, 0x04, 0x32, 0x08, 0x34, 0x08, 0x36, 0x08, 0x38, 0x08, 0x39, 0x04, 0x81, 0x10, 0x00, 0x32,
+    0x04, 0x34, 0x08, 0x32, 0x08, 0x31, 0x08, 0x2F, 0x08, 0x31, 0x04, 0x82, 0x08, 0x00, 0x2D, 0x08,
+    0x2C, 0x04, 0x82, 0x30, 0x00, 0x2D, 0x08, 0x2F, 0xFE, 0x8D, 0x39, 0x00, 0x81, 0x30, 0x00, 0x85,
+    0x20, 0x00, 0x82, 0x1F, 0x00, 0x2D, 0x08, 0x2F, 0x04, 0x81, 0x24, 0x00, 0x2D, 0x08, 0x2C, 0x08,
+    0x2D, 0xFE, 0x8D, 0x52, 0x00, 0x81, 0x49, 0x00, 0x85, 0x39, 0x00, 0x82, 0x38, 0x00, 0x81, 0x30,
+    0x00, 0x82, 0x5F, 0x00, 0x81, 0x2F, 0x00, 0x8D, 0x67, 0x00, 0x81, 0x5E, 0x00, 0x85, 0x4E, 0x00,
+    0x82, 0x4D, 0x00, 0x81, 0x2E, 0x00, 0x81, 0x51, 0x00, 0x82, 0x2D, 0x00, 0x3D, 0x04, 0x39, 0x08,
+    0x3B, 0x08, 0x3D, 0x08, 0x39, 0x08, 0x3B, 0x04, 0x82, 0x74, 0x00, 0x34, 0x08, 0x39, 0x04, 0x81,
+    0x79, 0x00, 0x39, 0x08, 0x34, 0x08, 0x33, 0x04, 0x31, 0x08, 0x33, 0x08, 0x2F, 0x04, 0x81, 0x9A,
+    0x00, 0x33, 0x08, 0x83, 0x8F, 0x00, 0x38, 0x04, 0x36, 0x04, 0x38, 0x04, 0x2F, 0x04, 0x33, 0x04,
+    0x34, 0xFE, 0x81, 0xB2, 0x00, 0x38, 0x08, 0x81, 0xA9, 0x00, 0x81, 0x6E, 0x00, 0x2D, 0x04, 0x34,
+    0x04, 0x32, 0x04, 0x31, 0x04, 0x2F, 0x08, 0x81, 0x7B, 0x00, 0x81, 0x85, 0x00, 0x28, 0x08, 0x2A,
+    0x08, 0x2C, 0x08, 0x82, 0xD1, 0x00, 0x81, 0x15, 0x00, 0x2F, 0x04, 0x31, 0x08, 0x34, 0x08, 0x2D,
+    0x04, 0x2C, 0x04, 0x2D, 0xFE,
+};
+static const Song minuetg_packed_song = {"Minuetg", nullptr, 190, 140, minuetg_packed};
+
+// Furelise: 603 notes, 4824 -> 743 bytes
+static const uint8_t furelise_packed[] = {
+    0x36, 0x10, 0x35, 0x10, 0x81, 0x04, 0x00, 0x36, 0x10, 0x31, 0x10, 0x34, 0x10, 0x32, 0x10, 0x2F,
+    0xF8, 0x26, 0x10, 0x2A, 0x10, 0x2F, 0x10, 0x31, 0xF8, 0x2A, 0x10, 0x2E, 0x10, 0x31, 0x10, 0x32,
+    0x08, 0x00, 0x10, 0x2A, 0x10, 0x81, 0x25, 0x00, 0x81, 0x28, 0x00, 0x89, 0x24, 0x00, 0x32, 0x10,
+    0x31, 0x10, 0x2F, 0x04, 0x00, 0x08, 0x81, 0x36, 0x00, 0x81, 0x39, 0x00, 0x8E, 0x35, 0x00, 0x81,
+    0x3F, 0x00, 0x81, 0x42, 0x00, 0x89, 0x3E, 0x00, 0x81, 0x1A, 0x00, 0x2F, 0x08, 0x00, 0x10, 0x31,
+    0x10, 0x32, 0x10, 0x34, 0x10, 0x36, 0xF8, 0x2D, 0x10, 0x37, 0x10, 0x36, 0x10, 0x34, 0xF8, 0x2B,
+    0x10, 0x36, 0x10, 0x34, 0x10, 0x32, 0xF8, 0x2A, 0x10, 0x81, 0x5E, 0x00, 0x31, 0x08, 0x81, 0x4D,
+    0x00, 0x36, 0x10, 0x00, 0x10, 0x00, 0x10, 0x36, 0x10, 0x42, 0x10, 0x81, 0x08, 0x00, 0x35, 0x10,
+    0x82, 0x0F, 0x00, 0x35, 0x10, 0x81, 0x85, 0x00, 0x81, 0x88, 0x00, 0x83, 0x84, 0x00, 0x81, 0x43,
+    0x00, 0x82, 0x80, 0x00, 0x31, 0x08, 0x81, 0x75, 0x00, 0x84, 0x7E, 0x00, 0x81, 0x9C, 0x00, 0x81,
+    0x9F, 0x00, 0x83, 0x9B, 0x00, 0x81, 0x5A, 0x00, 0x82, 0x97, 0x00, 0x31, 0x08, 0x81, 0x8C, 0x00,
+    0x81, 0x82, 0x00, 0x8E, 0x68, 0x00, 0x81, 0xAB, 0x00, 0x31, 0x08, 0x81, 0x9A, 0x00, 0x84, 0x4D,
+    0x00, 0x81, 0x4E, 0x00, 0x35, 0x10, 0x82, 0x55, 0x00, 0x35, 0x10, 0x81, 0xCB, 0x00, 0x81, 0xCE,
+    0x00, 0x83, 0xCA, 0x00, 0x81, 0x89, 0x00, 0x82, 0xC6, 0x00, 0x31, 0x08, 0x81, 0xBB, 0x00, 0x84,
+    0xC4, 0x00, 0x81, 0xE2, 0x00, 0x81, 0xE5, 0x00, 0x83, 0xE1, 0x00, 0x81, 0xA0, 0x00, 0x82, 0xDD,
+    0x00, 0x31, 0x08, 0x81, 0xD2, 0x00, 0x81, 0xC8, 0x00, 0x81, 0xAE, 0x00, 0x32, 0x10, 0x32, 0x10,
+    0x32, 0x10, 0x32, 0x04, 0x37, 0xF0, 0x36, 0x20, 0x36, 0x08, 0x34, 0x08, 0x3C, 0xF0, 0x3B, 0x20,
+    0x3B, 0x10, 0x39, 0x10, 0x81, 0xBB, 0x00, 0x81, 0x0C, 0x01, 0x30, 0x08, 0x2F, 0x08, 0x2F, 0x20,
+    0x2D, 0x20, 0x2F, 0x20, 0x31, 0x20, 0x32, 0x04, 0x34, 0x10, 0x35, 0x10, 0x36, 0xF8, 0x36, 0x10,
+    0x37, 0x10, 0x2F, 0x10, 0x32, 0x04, 0x34, 0xF0, 0x31, 0x20, 0x32, 0x20, 0x39, 0x20, 0x2D, 0x20,
+    0x39, 0x20, 0x2F, 0x20, 0x39, 0x20, 0x31, 0x20, 0x39, 0x20, 0x81, 0x10, 0x00, 0x34, 0x20, 0x39,
+    0x20, 0x36, 0x20, 0x39, 0x20, 0x3E, 0x20, 0x3D, 0x20, 0x3B, 0x20, 0x39, 0x20, 0x37, 0x20, 0x36,
+    0x20, 0x81, 0x14, 0x00, 0x37, 0x20, 0x34, 0x20, 0x87, 0x2E, 0x00, 0x81, 0x31, 0x00, 0x89, 0x21,
+    0x00, 0x81, 0x24, 0x00, 0x81, 0x10, 0x00, 0x36, 0x20, 0x81, 0x1C, 0x00, 0x35, 0x20, 0x36, 0x20,
+    0x31, 0x20, 0x36, 0x20, 0x83, 0x08, 0x00, 0x35, 0x20, 0x36, 0xF8, 0x31, 0x10, 0x81, 0x8D, 0x01,
+    0x81, 0x07, 0x00, 0x82, 0x22, 0x01, 0x35, 0x10, 0x82, 0x27, 0x01, 0x35, 0x10, 0x81, 0x9D, 0x01,
+    0x83, 0x99, 0x01, 0x81, 0x58, 0x01, 0x82, 0x95, 0x01, 0x31, 0x08, 0x81, 0x8A, 0x01, 0x84, 0x93,
+    0x01, 0x81, 0xB1, 0x01, 0x81, 0xB4, 0x01, 0x83, 0xB0, 0x01, 0x81, 0x6F, 0x01, 0x82, 0xAC, 0x01,
+    0x31, 0x08, 0x81, 0xA1, 0x01, 0x81, 0x97, 0x01, 0x8E, 0x7D, 0x01, 0x81, 0xC0, 0x01, 0x31, 0x08,
+    0x81, 0xAF, 0x01, 0x84, 0x62, 0x01, 0x81, 0x63, 0x01, 0x35, 0x10, 0x82, 0x6A, 0x01, 0x35, 0x10,
+    0x81, 0x7F, 0x01, 0x81, 0xE3, 0x01, 0x83, 0xDF, 0x01, 0x81, 0x9E, 0x01, 0x82, 0xDB, 0x01, 0x31,
+    0x08, 0x81, 0xD0, 0x01, 0x84, 0xD9, 0x01, 0x81, 0xF7, 0x01, 0x81, 0xFA, 0x01, 0x83, 0xF6, 0x01,
+    0x81, 0xB5, 0x01, 0x82, 0xF2, 0x01, 0x31, 0x08, 0x81, 0xE7, 0x01, 0x81, 0xDD, 0x01, 0x81, 0xC3,
+    0x01, 0x00, 0x10, 0x00, 0x08, 0x33, 0xFC, 0x34, 0x04, 0x81, 0xEB, 0x00, 0x37, 0x04, 0x37, 0x08,
+    0x36, 0xFC, 0x34, 0x04, 0x82, 0xF6, 0x01, 0x2F, 0x08, 0x2F, 0x08, 0x32, 0x08, 0x31, 0x08, 0x2F,
+    0xFC, 0x81, 0x1C, 0x00, 0x81, 0x06, 0x01, 0x81, 0x1B, 0x00, 0x37, 0xFC, 0x35, 0x04, 0x81, 0x33,
+    0x02, 0x30, 0x04, 0x2F, 0x08, 0x2E, 0x04, 0x2D, 0x08, 0x2F, 0xFC, 0x31, 0x04, 0x00, 0x08, 0x23,
+    0xE0, 0x26, 0xE0, 0x2A, 0xE0, 0x2F, 0xE0, 0x32, 0xE0, 0x36, 0xE0, 0x34, 0xE0, 0x32, 0xE0, 0x31,
+    0xE0, 0x82, 0x0C, 0x00, 0x3B, 0xE0, 0x3E, 0xE0, 0x42, 0xE0, 0x40, 0xE0, 0x3E, 0xE0, 0x3D, 0xE0,
+    0x82, 0x1B, 0x00, 0x85, 0x0F, 0x00, 0x3C, 0xE0, 0x3B, 0xE0, 0x3A, 0xE0, 0x39, 0xE0, 0x38, 0xE0,
+    0x37, 0xE0, 0x36, 0xE0, 0x35, 0xE0, 0x34, 0xE0, 0x33, 0xE0, 0x81, 0x2D, 0x00, 0x30, 0xE0, 0x2F,
+    0xE0, 0x2E, 0xE0, 0x2D, 0xE0, 0x2C, 0xE0, 0x2B, 0xE0, 0x2A, 0x10, 0x35, 0x10, 0x8E, 0x96, 0x02,
+    0x81, 0xA0, 0x02, 0x81, 0xA3, 0x02, 0x89, 0x9F, 0x02, 0x81, 0x7B, 0x02, 0x2F, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x82, 0x5B, 0x02, 0x34, 0x04, 0x00, 0x08, 0x00, 0xF8, 0x2A, 0x10, 0x81, 0xB2, 0x02,
+    0x81, 0xA9, 0x02, 0x36, 0x08, 0x36, 0x08, 0x42, 0xF8, 0x35, 0x10, 0x82, 0x5A, 0x02, 0x35, 0x10,
+    0x81, 0xD0, 0x02, 0x81, 0xD3, 0x02, 0x8E, 0xCF, 0x02, 0x81, 0xD9, 0x02, 0x81, 0xDC, 0x02, 0x89,
+    0xD8, 0x02, 0x81, 0xB4, 0x02, 0x2F, 0xFC,
+};
+static const Song furelise_packed_song = {"Furelise", nullptr, 603, 80, furelise_packed};
+
+// Greenhill: 175 notes, 1400 -> 223 bytes
+static const uint8_t greenhill_packed[] = {
+    0x00, 0x02, 0x34, 0x08, 0x31, 0x04, 0x34, 0x08, 0x33, 0x04, 0x81, 0x04, 0x00, 0x2F, 0x02, 0x00,
+    0x08, 0x2F, 0x08, 0x38, 0x08, 0x36, 0x04, 0x81, 0x11, 0x00, 0x81, 0x14, 0x00, 0x2F, 0x02, 0x00,
+    0x04, 0x83, 0x1F, 0x00, 0x81, 0x1E, 0x00, 0x81, 0x1A, 0x00, 0x31, 0x08, 0x31, 0x08, 0x2D, 0x04,
+    0x31, 0x08, 0x2F, 0x04, 0x81, 0x04, 0x00, 0x28, 0x02, 0x00, 0x04, 0x83, 0x39, 0x00, 0x81, 0x38,
+    0x00, 0x84, 0x34, 0x00, 0x81, 0x3E, 0x00, 0x81, 0x41, 0x00, 0x81, 0x2D, 0x00, 0x83, 0x4B, 0x00,
+    0x81, 0x4A, 0x00, 0x81, 0x46, 0x00, 0x84, 0x2C, 0x00, 0x81, 0x29, 0x00, 0x28, 0x08, 0x28, 0x08,
+    0x2C, 0x08, 0x2A, 0xFF, 0x00, 0x08, 0x28, 0x08, 0x2A, 0x08, 0x2C, 0xFF, 0x81, 0x08, 0x00, 0x81,
+    0x11, 0x00, 0x2B, 0xFF, 0x81, 0x10, 0x00, 0x2B, 0x08, 0x2A, 0xFF, 0x84, 0x7B, 0x00, 0x81, 0x78,
+    0x00, 0x84, 0x74, 0x00, 0x81, 0x7E, 0x00, 0x81, 0x81, 0x00, 0x81, 0x6D, 0x00, 0x83, 0x8B, 0x00,
+    0x81, 0x8A, 0x00, 0x81, 0x86, 0x00, 0x84, 0x6C, 0x00, 0x81, 0x69, 0x00, 0x81, 0x65, 0x00, 0x83,
+    0x9D, 0x00, 0x81, 0x9C, 0x00, 0x84, 0x98, 0x00, 0x81, 0xA2, 0x00, 0x81, 0xA5, 0x00, 0x81, 0x91,
+    0x00, 0x83, 0xAF, 0x00, 0x81, 0xAE, 0x00, 0x81, 0xAA, 0x00, 0x84, 0x90, 0x00, 0x81, 0x8D, 0x00,
+    0x87, 0x64, 0x00, 0x81, 0x5F, 0x00, 0x81, 0x68, 0x00, 0x2B, 0xFF, 0x81, 0x67, 0x00, 0x2B, 0x08,
+    0x2A, 0x08, 0x2A, 0xFE, 0x2F, 0x08, 0x33, 0x08, 0x81, 0xC5, 0x00, 0x34, 0x08, 0x3B, 0xFC,
+};
+static const Song greenhill_packed_song = {"Greenhill", nullptr, 175, 140, greenhill_packed};
+
+// Professorlayton: 418 notes, 3344 -> 675 bytes
+static const uint8_t professorlayton_packed[] = {
+    0x34, 0x01, 0x35, 0x01, 0x37, 0x01, 0x00, 0x04, 0x37, 0xFC, 0x35, 0x08, 0x34, 0x08, 0x37, 0x01,
+    0x30, 0x08, 0x2D, 0xFE, 0x2B, 0x01, 0x2B, 0x01, 0x00, 0x04, 0x00, 0x08, 0x2B, 0x08, 0x2D, 0x08,
+    0x2E, 0x08, 0x30, 0x08, 0x32, 0x08, 0x82, 0x26, 0x00, 0x82, 0x21, 0x00, 0x33, 0x08, 0x32, 0xFE,
+    0x30, 0x08, 0x2D, 0x01, 0x2B, 0xFF, 0x00, 0x04, 0x34, 0xFC, 0x00, 0x10, 0x34, 0x10, 0x34, 0x02,
+    0x00, 0x04, 0x34, 0x08, 0x35, 0x08, 0x37, 0x08, 0x39, 0x08, 0x37, 0x08, 0x81, 0x42, 0x00, 0x34,
+    0xFC, 0x35, 0x10, 0x35, 0x02, 0x00, 0x04, 0x2D, 0x08, 0x32, 0x08, 0x82, 0x19, 0x00, 0x81, 0x54,
+    0x00, 0x32, 0xFC, 0x00, 0x10, 0x2D, 0x02, 0x81, 0x12, 0x00, 0x82, 0x4A, 0x00, 0x30, 0x08, 0x2E,
+    0x08, 0x39, 0x08, 0x2B, 0xFC, 0x30, 0xFC, 0x2D, 0x02, 0x00, 0x08, 0x26, 0x08, 0x28, 0x08, 0x29,
+    0x08, 0x81, 0x2A, 0x00, 0x81, 0x4C, 0x00, 0x34, 0xF0, 0x86, 0x4B, 0x00, 0x81, 0x82, 0x00, 0x34,
+    0xFC, 0x35, 0xF0, 0x81, 0x40, 0x00, 0x32, 0x08, 0x82, 0x56, 0x00, 0x81, 0x91, 0x00, 0x30, 0x08,
+    0x30, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x2B, 0xFC, 0x00, 0x08, 0x2D, 0x04, 0x34, 0x04, 0x35, 0x04,
+    0x81, 0x78, 0x00, 0x32, 0x10, 0x32, 0x02, 0x00, 0x04, 0x81, 0x0D, 0x00, 0x37, 0x04, 0x39, 0xFC,
+    0x00, 0x10, 0x37, 0x02, 0x3C, 0xFC, 0x39, 0xFC, 0x35, 0x04, 0x81, 0x92, 0x00, 0x81, 0x7A, 0x00,
+    0x32, 0x08, 0x81, 0x90, 0x00, 0x36, 0x08, 0x37, 0x08, 0x38, 0x08, 0x39, 0xFC, 0x37, 0xFC, 0x00,
+    0x04, 0x3C, 0x02, 0x39, 0x04, 0x81, 0x9F, 0x00, 0x00, 0x08, 0x36, 0x08, 0x00, 0x08, 0x34, 0x08,
+    0x32, 0xFE, 0x00, 0x08, 0x2D, 0x08, 0x2F, 0x08, 0x81, 0xD6, 0x00, 0x81, 0xB9, 0x00, 0x35, 0xFC,
+    0x34, 0xFC, 0x30, 0x04, 0x00, 0x04, 0x35, 0x08, 0x36, 0x08, 0x37, 0x04, 0x36, 0x08, 0x81, 0x04,
+    0x01, 0x3C, 0x08, 0x32, 0x04, 0x2D, 0x08, 0x34, 0x04, 0x81, 0x04, 0x00, 0x00, 0x08, 0x38, 0x08,
+    0x39, 0x08, 0x38, 0x08, 0x37, 0x08, 0x81, 0x1C, 0x01, 0x35, 0x08, 0x00, 0x08, 0x3C, 0x08, 0x39,
+    0x08, 0x81, 0xED, 0x00, 0x00, 0x08, 0x39, 0x08, 0x81, 0x1C, 0x00, 0x37, 0x08, 0x81, 0xF9, 0x00,
+    0x81, 0x36, 0x01, 0x35, 0x08, 0x34, 0xFC, 0x32, 0xFC, 0x00, 0x04, 0x00, 0x04, 0x32, 0x08, 0x81,
+    0x0D, 0x01, 0x34, 0x08, 0x32, 0x08, 0x30, 0x08, 0x83, 0x16, 0x01, 0x81, 0x09, 0x00, 0x83, 0x1C,
+    0x01, 0x3C, 0x08, 0x3A, 0x08, 0x81, 0x1D, 0x01, 0x81, 0x24, 0x01, 0x35, 0x08, 0x34, 0x10, 0x35,
+    0x10, 0x34, 0x10, 0x81, 0x51, 0x01, 0x83, 0x34, 0x01, 0x81, 0x18, 0x00, 0x81, 0x34, 0x01, 0x81,
+    0x75, 0x01, 0x35, 0x08, 0x32, 0x08, 0x82, 0x44, 0x01, 0x32, 0x08, 0x81, 0x34, 0x01, 0x82, 0x4C,
+    0x01, 0x3C, 0x08, 0x37, 0x08, 0x81, 0x8B, 0x01, 0x30, 0x08, 0x81, 0x90, 0x01, 0x82, 0x30, 0x00,
+    0x81, 0x49, 0x01, 0x82, 0x61, 0x01, 0x37, 0x08, 0x81, 0x17, 0x00, 0x81, 0xA1, 0x01, 0x81, 0xA4,
+    0x01, 0x30, 0x08, 0x83, 0x71, 0x01, 0x30, 0x08, 0x2D, 0x08, 0x30, 0x08, 0x35, 0x08, 0x3C, 0x08,
+    0x81, 0x04, 0x00, 0x3A, 0x08, 0x39, 0x08, 0x81, 0x04, 0x00, 0x37, 0x08, 0x83, 0x61, 0x00, 0x81,
+    0xAD, 0x01, 0x82, 0x90, 0x01, 0x3E, 0x08, 0x34, 0x08, 0x3C, 0x08, 0x81, 0x89, 0x00, 0x34, 0x08,
+    0x3D, 0x08, 0x2D, 0x08, 0x26, 0x08, 0x29, 0x08, 0x81, 0x91, 0x01, 0x35, 0x08, 0x39, 0x08, 0x00,
+    0x08, 0x32, 0x08, 0x81, 0xB1, 0x01, 0x82, 0x89, 0x00, 0x32, 0x08, 0x81, 0xA4, 0x01, 0x39, 0x08,
+    0x34, 0xFC, 0x32, 0x08, 0x32, 0x01, 0x00, 0x04, 0x29, 0x08, 0x26, 0xFC, 0x29, 0x02, 0x40, 0x02,
+    0x25, 0x02, 0x81, 0x0A, 0x00, 0x21, 0x02, 0x81, 0x09, 0x00, 0x81, 0x12, 0x00, 0x2D, 0x02, 0x2C,
+    0x02, 0x28, 0x02, 0x2B, 0x02, 0x28, 0x02, 0x28, 0x02, 0x2D, 0x02, 0x2D, 0x01, 0x2D, 0x01, 0x81,
+    0x04, 0x00, 0x00, 0x01, 0x00, 0x01, 0x81, 0x0B, 0x00, 0x29, 0x02, 0x2D, 0x02, 0x2D, 0x02, 0x26,
+    0x04, 0x81, 0xC4, 0x01, 0x2B, 0x02, 0x30, 0x02, 0x30, 0x02, 0x26, 0x04, 0x81, 0xCF, 0x01, 0x29,
+    0x02, 0x2D, 0xFE, 0x2B, 0x02, 0x2D, 0x08, 0x2B, 0x08, 0x2D, 0xFE, 0x28, 0xFF, 0x26, 0x02, 0x81,
+    0x0E, 0x00, 0x81, 0xE5, 0x01, 0x2B, 0x02, 0x24, 0x02, 0x81, 0x21, 0x00, 0x81, 0xEF, 0x01, 0x29,
+    0x02, 0x30, 0xFE, 0x2E, 0x02, 0x81, 0x20, 0x00, 0x2B, 0x08, 0x2D, 0xFF, 0x83, 0x43, 0x00, 0x81,
+    0x02, 0x02, 0x83, 0x3E, 0x00, 0x81, 0x08, 0x02, 0x87, 0x39, 0x00, 0x81, 0x3A, 0x00, 0x81, 0x11,
+    0x02, 0x81, 0x2C, 0x00, 0x81, 0x4C, 0x00, 0x81, 0x1A, 0x02, 0x82, 0x2B, 0x00, 0x81, 0x48, 0x00,
+    0x81, 0x28, 0x00,
+};
+static const Song professorlayton_packed_song = {"Professorlayton", nullptr, 418, 140, professorlayton_packed};
+
+// Asabranca: 92 notes, 736 -> 120 bytes
+static const uint8_t asabranca_packed[] = {
+    0x2D, 0x08, 0x2F, 0x08, 0x31, 0x04, 0x34, 0x04, 0x34, 0x04, 0x31, 0x04, 0x32, 0x04, 0x32, 0x02,
+    0x84, 0x10, 0x00, 0x32, 0x04, 0x31, 0x02, 0x00, 0x08, 0x2D, 0x08, 0x83, 0x1B, 0x00, 0x00, 0x08,
+    0x34, 0x08, 0x32, 0x08, 0x31, 0x08, 0x2D, 0x04, 0x32, 0x04, 0x00, 0x08, 0x81, 0x0A, 0x00, 0x2F,
+    0x08, 0x2F, 0x04, 0x31, 0x04, 0x00, 0x08, 0x31, 0x08, 0x2F, 0x08, 0x2D, 0x08, 0x2D, 0x02, 0x81,
+    0x28, 0x00, 0x83, 0x42, 0x00, 0x86, 0x27, 0x00, 0x81, 0x26, 0x00, 0x86, 0x1C, 0x00, 0x2D, 0x04,
+    0x37, 0x08, 0x34, 0x08, 0x36, 0x08, 0x32, 0x08, 0x34, 0x08, 0x31, 0x08, 0x32, 0x08, 0x2F, 0x08,
+    0x31, 0x08, 0x81, 0x62, 0x00, 0x2D, 0x08, 0x2A, 0x08, 0x2D, 0x08, 0x89, 0x1D, 0x00, 0x81, 0x6E,
+    0x00, 0x82, 0x0C, 0x00, 0x2D, 0xFE, 0x00, 0x04,
+};
+static const Song asabranca_packed_song = {"Asabranca", nullptr, 92, 120, asabranca_packed};
+
+// Doom: 680 notes, 5440 -> 1020 bytes
+static const uint8_t doom_packed[] = {
+    0x12, 0x08, 0x12, 0x08, 0x1E, 0x08, 0x81, 0x06, 0x00, 0x1C, 0x08, 0x81, 0x0B, 0x00, 0x1A, 0x08,
+    0x81, 0x10, 0x00, 0x18, 0x08, 0x81, 0x15, 0x00, 0x19, 0x08, 0x1A, 0x08, 0x82, 0x1C, 0x00, 0x81,
+    0x1F, 0x00, 0x1C, 0x08, 0x81, 0x24, 0x00, 0x1A, 0x08, 0x81, 0x29, 0x00, 0x18, 0xFE, 0x82, 0x2E,
+    0x00, 0x81, 0x31, 0x00, 0x1C, 0x08, 0x81, 0x36, 0x00, 0x1A, 0x08, 0x81, 0x3B, 0x00, 0x18, 0x08,
+    0x81, 0x40, 0x00, 0x81, 0x2B, 0x00, 0x82, 0x46, 0x00, 0x81, 0x49, 0x00, 0x1C, 0x08, 0x81, 0x4E,
+    0x00, 0x1A, 0x08, 0x81, 0x53, 0x00, 0x18, 0xFE, 0x82, 0x58, 0x00, 0x81, 0x5B, 0x00, 0x1C, 0x08,
+    0x81, 0x60, 0x00, 0x1A, 0x08, 0x81, 0x65, 0x00, 0x18, 0x08, 0x81, 0x6A, 0x00, 0x81, 0x55, 0x00,
+    0x82, 0x70, 0x00, 0x81, 0x73, 0x00, 0x1C, 0x08, 0x81, 0x78, 0x00, 0x1A, 0x08, 0x81, 0x7D, 0x00,
+    0x18, 0xFE, 0x82, 0x82, 0x00, 0x81, 0x85, 0x00, 0x1C, 0x08, 0x81, 0x8A, 0x00, 0x1A, 0x08, 0x81,
+    0x8F, 0x00, 0x18, 0x08, 0x81, 0x94, 0x00, 0x81, 0x7F, 0x00, 0x82, 0x9A, 0x00, 0x81, 0x9D, 0x00,
+    0x1C, 0x08, 0x81, 0xA2, 0x00, 0x20, 0xF0, 0x1C, 0xF0, 0x19, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x19,
+    0xF0, 0x1C, 0xF0, 0x20, 0xF0, 0x81, 0x0A, 0x00, 0x81, 0x11, 0x00, 0x82, 0xBB, 0x00, 0x81, 0xBE,
+    0x00, 0x1C, 0x08, 0x81, 0xC3, 0x00, 0x1A, 0x08, 0x81, 0xC8, 0x00, 0x18, 0x08, 0x81, 0xCD, 0x00,
+    0x81, 0xB8, 0x00, 0x82, 0xD3, 0x00, 0x81, 0xD6, 0x00, 0x1C, 0x08, 0x81, 0xDB, 0x00, 0x1A, 0x08,
+    0x81, 0xE0, 0x00, 0x18, 0xFE, 0x82, 0xE5, 0x00, 0x81, 0xE8, 0x00, 0x1C, 0x08, 0x81, 0xED, 0x00,
+    0x1A, 0x08, 0x81, 0xF2, 0x00, 0x18, 0x08, 0x81, 0xF7, 0x00, 0x81, 0xE2, 0x00, 0x82, 0xFD, 0x00,
+    0x81, 0x00, 0x01, 0x1C, 0x08, 0x81, 0x05, 0x01, 0x25, 0xF0, 0x21, 0xF0, 0x1E, 0xF0, 0x21, 0xF0,
+    0x25, 0xF0, 0x2A, 0xF0, 0x82, 0x06, 0x00, 0x25, 0xF0, 0x2D, 0xF0, 0x31, 0xF0, 0x17, 0x08, 0x17,
+    0x08, 0x23, 0x08, 0x81, 0x06, 0x00, 0x21, 0x08, 0x81, 0x0B, 0x00, 0x1F, 0x08, 0x81, 0x10, 0x00,
+    0x1D, 0x08, 0x81, 0x15, 0x00, 0x1E, 0x08, 0x1F, 0x08, 0x82, 0x1C, 0x00, 0x81, 0x1F, 0x00, 0x21,
+    0x08, 0x81, 0x24, 0x00, 0x1F, 0x08, 0x81, 0x29, 0x00, 0x1D, 0xFE, 0x82, 0x2E, 0x00, 0x81, 0x31,
+    0x00, 0x21, 0x08, 0x81, 0x36, 0x00, 0x1F, 0x08, 0x81, 0x3B, 0x00, 0x1D, 0x08, 0x81, 0x40, 0x00,
+    0x81, 0x2B, 0x00, 0x82, 0x46, 0x00, 0x81, 0x49, 0x00, 0x21, 0x08, 0x81, 0x4E, 0x00, 0x23, 0xF0,
+    0x1F, 0xF0, 0x1C, 0xF0, 0x82, 0x06, 0x00, 0x26, 0xF0, 0x81, 0x0B, 0x00, 0x82, 0x0E, 0x00, 0x82,
+    0x7F, 0x01, 0x81, 0x82, 0x01, 0x1C, 0x08, 0x81, 0x87, 0x01, 0x1A, 0x08, 0x81, 0x8C, 0x01, 0x18,
+    0x08, 0x81, 0x91, 0x01, 0x81, 0x7C, 0x01, 0x82, 0x97, 0x01, 0x81, 0x9A, 0x01, 0x1C, 0x08, 0x81,
+    0x9F, 0x01, 0x1A, 0x08, 0x81, 0xA4, 0x01, 0x18, 0xFE, 0x82, 0xA9, 0x01, 0x81, 0xAC, 0x01, 0x1C,
+    0x08, 0x81, 0xB1, 0x01, 0x1A, 0x08, 0x81, 0xB6, 0x01, 0x18, 0x08, 0x81, 0xBB, 0x01, 0x81, 0xA6,
+    0x01, 0x82, 0xC1, 0x01, 0x81, 0xC4, 0x01, 0x1C, 0x08, 0x81, 0xC9, 0x01, 0x1A, 0x08, 0x81, 0xCE,
+    0x01, 0x18, 0xFE, 0x1B, 0x08, 0x1B, 0x08, 0x27, 0x08, 0x81, 0x06, 0x00, 0x25, 0x08, 0x81, 0x0B,
+    0x00, 0x23, 0x08, 0x81, 0x10, 0x00, 0x21, 0x08, 0x81, 0x15, 0x00, 0x22, 0x08, 0x23, 0x08, 0x19,
+    0x08, 0x19, 0x08, 0x25, 0x08, 0x81, 0x06, 0x00, 0x82, 0x0B, 0x00, 0x21, 0x08, 0x81, 0x0E, 0x00,
+    0x1F, 0xFE, 0x82, 0x02, 0x02, 0x81, 0x05, 0x02, 0x1C, 0x08, 0x81, 0x0A, 0x02, 0x1A, 0x08, 0x81,
+    0x0F, 0x02, 0x18, 0x08, 0x81, 0x14, 0x02, 0x81, 0xFF, 0x01, 0x82, 0x1A, 0x02, 0x81, 0x1D, 0x02,
+    0x1C, 0x08, 0x81, 0x22, 0x02, 0x85, 0x1D, 0x01, 0x82, 0x1A, 0x01, 0x82, 0x14, 0x01, 0x82, 0x2E,
+    0x02, 0x81, 0x31, 0x02, 0x1C, 0x08, 0x81, 0x36, 0x02, 0x1A, 0x08, 0x81, 0x3B, 0x02, 0x18, 0x08,
+    0x81, 0x40, 0x02, 0x81, 0x2B, 0x02, 0x82, 0x46, 0x02, 0x81, 0x49, 0x02, 0x1C, 0x08, 0x81, 0x4E,
+    0x02, 0x1A, 0x08, 0x81, 0x53, 0x02, 0x18, 0xFE, 0x82, 0x58, 0x02, 0x81, 0x5B, 0x02, 0x1C, 0x08,
+    0x81, 0x60, 0x02, 0x1A, 0x08, 0x81, 0x65, 0x02, 0x18, 0x08, 0x81, 0x6A, 0x02, 0x81, 0x55, 0x02,
+    0x82, 0x70, 0x02, 0x81, 0x73, 0x02, 0x1C, 0x08, 0x81, 0x78, 0x02, 0x20, 0xF0, 0x1D, 0xF0, 0x19,
+    0xF0, 0x82, 0x06, 0x00, 0x21, 0xF0, 0x81, 0xDF, 0x01, 0x29, 0xF0, 0x81, 0x0E, 0x00, 0x82, 0x8E,
+    0x02, 0x81, 0x91, 0x02, 0x1C, 0x08, 0x81, 0x96, 0x02, 0x1A, 0x08, 0x81, 0x9B, 0x02, 0x18, 0x08,
+    0x81, 0xA0, 0x02, 0x81, 0x8B, 0x02, 0x82, 0xA6, 0x02, 0x81, 0xA9, 0x02, 0x1C, 0x08, 0x81, 0xAE,
+    0x02, 0x1A, 0x08, 0x81, 0xB3, 0x02, 0x18, 0xFE, 0x82, 0xB8, 0x02, 0x81, 0xBB, 0x02, 0x1C, 0x08,
+    0x81, 0xC0, 0x02, 0x1A, 0x08, 0x81, 0xC5, 0x02, 0x18, 0x08, 0x81, 0xCA, 0x02, 0x81, 0xB5, 0x02,
+    0x82, 0xD0, 0x02, 0x81, 0xD3, 0x02, 0x1C, 0x08, 0x81, 0xD8, 0x02, 0x2A, 0xF0, 0x81, 0xD5, 0x01,
+    0x2D, 0xF0, 0x2A, 0xF0, 0x81, 0xD6, 0x01, 0x28, 0xF0, 0x2A, 0xF0, 0x81, 0x0B, 0x00, 0x21, 0xF0,
+    0x82, 0xF0, 0x02, 0x81, 0xF3, 0x02, 0x1C, 0x08, 0x81, 0xF8, 0x02, 0x1A, 0x08, 0x81, 0xFD, 0x02,
+    0x18, 0x08, 0x81, 0x02, 0x03, 0x81, 0xED, 0x02, 0x82, 0x08, 0x03, 0x81, 0x0B, 0x03, 0x1C, 0x08,
+    0x81, 0x10, 0x03, 0x1A, 0x08, 0x81, 0x15, 0x03, 0x18, 0xFE, 0x82, 0xFD, 0x01, 0x81, 0x00, 0x02,
+    0x21, 0x08, 0x81, 0x05, 0x02, 0x1F, 0x08, 0x81, 0x0A, 0x02, 0x1D, 0x08, 0x81, 0x0F, 0x02, 0x81,
+    0xFA, 0x01, 0x82, 0x15, 0x02, 0x81, 0x18, 0x02, 0x21, 0x08, 0x81, 0x1D, 0x02, 0x82, 0xCF, 0x01,
+    0x82, 0xD2, 0x01, 0x26, 0xF0, 0x81, 0xD7, 0x01, 0x82, 0xDA, 0x01, 0x82, 0x4B, 0x03, 0x81, 0x4E,
+    0x03, 0x1C, 0x08, 0x81, 0x53, 0x03, 0x1A, 0x08, 0x81, 0x58, 0x03, 0x18, 0x08, 0x81, 0x5D, 0x03,
+    0x81, 0x48, 0x03, 0x82, 0x63, 0x03, 0x81, 0x66, 0x03, 0x1C, 0x08, 0x81, 0x6B, 0x03, 0x1A, 0x08,
+    0x81, 0x70, 0x03, 0x18, 0xFE, 0x82, 0x75, 0x03, 0x81, 0x78, 0x03, 0x1C, 0x08, 0x81, 0x7D, 0x03,
+    0x1A, 0x08, 0x81, 0x82, 0x03, 0x18, 0x08, 0x81, 0x87, 0x03, 0x81, 0x72, 0x03, 0x82, 0x8D, 0x03,
+    0x81, 0x90, 0x03, 0x1C, 0x08, 0x81, 0x95, 0x03, 0x1A, 0x08, 0x81, 0x9A, 0x03, 0x18, 0xFE, 0x82,
+    0x9F, 0x03, 0x81, 0xA2, 0x03, 0x1C, 0x08, 0x81, 0xA7, 0x03, 0x1A, 0x08, 0x81, 0xAC, 0x03, 0x18,
+    0x08, 0x81, 0xB1, 0x03, 0x81, 0x9C, 0x03, 0x82, 0xB7, 0x03, 0x81, 0xBA, 0x03, 0x1C, 0x08, 0x81,
+    0xBF, 0x03, 0x1A, 0x08, 0x81, 0xC4, 0x03, 0x18, 0xFE, 0x82, 0xC9, 0x03, 0x81, 0xCC, 0x03, 0x1C,
+    0x08, 0x81, 0xD1, 0x03, 0x1A, 0x08, 0x81, 0xD6, 0x03, 0x18, 0x08, 0x81, 0xDB, 0x03, 0x81, 0xC6,
+    0x03, 0x82, 0xE1, 0x03, 0x81, 0xE4, 0x03, 0x1C, 0x08, 0x81, 0xE9, 0x03, 0x82, 0xE4, 0x02, 0x19,
+    0xF0, 0x81, 0xE5, 0x02, 0x26, 0xF0, 0x81, 0xEE, 0x02, 0x82, 0xF1, 0x02,
+};
+static const Song doom_packed_song = {"Doom", nullptr, 680, 225, doom_packed};
+
+// Odetojoy: 62 notes, 496 -> 72 bytes
+static const uint8_t odetojoy_packed[] = {
+    0x2A, 0x04, 0x2A, 0x04, 0x2B, 0x04, 0x2D, 0x04, 0x2D, 0x04, 0x2B, 0x04, 0x2A, 0x04, 0x28, 0x04,
+    0x26, 0x04, 0x26, 0x04, 0x28, 0x04, 0x2A, 0x04, 0x2A, 0xFC, 0x28, 0x08, 0x28, 0x02, 0x8B, 0x1E,
+    0x00, 0x28, 0xFC, 0x26, 0x08, 0x26, 0x02, 0x28, 0x04, 0x81, 0x15, 0x00, 0x81, 0x1A, 0x00, 0x2A,
+    0x08, 0x2B, 0x08, 0x2A, 0x04, 0x81, 0x23, 0x00, 0x82, 0x09, 0x00, 0x81, 0x2D, 0x00, 0x28, 0x04,
+    0x21, 0x02, 0x8B, 0x42, 0x00, 0x82, 0x24, 0x00,
+};
+static const Song odetojoy_packed_song = {"Odetojoy", nullptr, 62, 114, odetojoy_packed};
+
+// Supermariobros: 321 notes, 2568 -> 347 bytes
+static const uint8_t supermariobros_packed[] = {
+    0x36, 0x08, 0x36, 0x08, 0x00, 0x08, 0x81, 0x04, 0x00, 0x32, 0x08, 0x36, 0x08, 0x39, 0x04, 0x00,
+    0x04, 0x2D, 0x08, 0x00, 0x04, 0x32, 0xFC, 0x81, 0x06, 0x00, 0x2A, 0xFC, 0x2F, 0x04, 0x31, 0x04,
+    0x30, 0x08, 0x2F, 0x04, 0x2D, 0xF8, 0x36, 0xF8, 0x39, 0xF8, 0x3B, 0x04, 0x37, 0x08, 0x39, 0x08,
+    0x00, 0x08, 0x36, 0x04, 0x32, 0x08, 0x34, 0x08, 0x31, 0xFC, 0x32, 0xFC, 0x81, 0x2B, 0x00, 0x8F,
+    0x25, 0x00, 0x00, 0x04, 0x39, 0x08, 0x38, 0x08, 0x37, 0x08, 0x35, 0x04, 0x81, 0x4A, 0x00, 0x2E,
+    0x08, 0x2F, 0x08, 0x26, 0x08, 0x00, 0x08, 0x2F, 0x08, 0x81, 0x25, 0x00, 0x00, 0x04, 0x35, 0x04,
+    0x00, 0x08, 0x34, 0xFC, 0x32, 0x02, 0x00, 0x02, 0x84, 0x26, 0x00, 0x81, 0x69, 0x00, 0x84, 0x1F,
+    0x00, 0x81, 0x3D, 0x00, 0x85, 0x18, 0x00, 0x32, 0x08, 0x32, 0x04, 0x32, 0x08, 0x00, 0x08, 0x32,
+    0x08, 0x34, 0x04, 0x36, 0x08, 0x32, 0x04, 0x2F, 0x08, 0x2D, 0x02, 0x84, 0x14, 0x00, 0x34, 0x08,
+    0x36, 0x08, 0x00, 0x01, 0x89, 0x1D, 0x00, 0x82, 0x97, 0x00, 0x81, 0x98, 0x00, 0x32, 0x08, 0x36,
+    0x04, 0x81, 0x94, 0x00, 0x2D, 0x04, 0x81, 0x93, 0x00, 0x81, 0x98, 0x00, 0x90, 0x92, 0x00, 0x81,
+    0x9E, 0x00, 0x8F, 0x98, 0x00, 0x81, 0x32, 0x00, 0x81, 0xA7, 0x00, 0x2E, 0x04, 0x2F, 0x08, 0x37,
+    0x04, 0x37, 0x08, 0x2F, 0x02, 0x34, 0xF8, 0x3B, 0xF8, 0x3B, 0xF8, 0x3B, 0xF8, 0x39, 0xF8, 0x37,
+    0xF8, 0x83, 0x4E, 0x00, 0x81, 0x51, 0x00, 0x81, 0xC6, 0x00, 0x84, 0x1F, 0x00, 0x31, 0x08, 0x81,
+    0x20, 0x00, 0x37, 0xF8, 0x36, 0xF8, 0x34, 0xF8, 0x32, 0x08, 0x2A, 0x04, 0x2A, 0x08, 0x26, 0x02,
+    0x81, 0x6D, 0x00, 0x81, 0xE2, 0x00, 0x8A, 0x3B, 0x00, 0x83, 0x76, 0x00, 0x81, 0x79, 0x00, 0x81,
+    0xEE, 0x00, 0x84, 0x47, 0x00, 0x31, 0x08, 0x81, 0x48, 0x00, 0x86, 0x28, 0x00, 0x84, 0x96, 0x00,
+    0x82, 0x82, 0x00, 0x89, 0x9C, 0x00, 0x82, 0x16, 0x01, 0x81, 0x17, 0x01, 0x81, 0x7F, 0x00, 0x81,
+    0x12, 0x01, 0x2D, 0x04, 0x00, 0x04, 0x81, 0xA3, 0x00, 0x81, 0x18, 0x01, 0x8A, 0x71, 0x00, 0x83,
+    0xAC, 0x00, 0x81, 0xAF, 0x00, 0x81, 0x24, 0x01, 0x84, 0x7D, 0x00, 0x31, 0x08, 0x81, 0x7E, 0x00,
+    0x86, 0x5E, 0x00, 0x32, 0xFC, 0x2D, 0xFC, 0x2A, 0x04, 0x2F, 0xF8, 0x31, 0xF8, 0x2F, 0xF8, 0x2E,
+    0xF8, 0x30, 0xF8, 0x2E, 0xF8, 0x2D, 0x08, 0x28, 0x08, 0x2A, 0xFE,
+};
+static const Song supermariobros_packed_song = {"Supermariobros", nullptr, 321, 200, supermariobros_packed};
+
+// Greensleeves: 136 notes, 1088 -> 92 bytes
+static const uint8_t greensleeves_packed[] = {
+    0x2D, 0x08, 0x30, 0x04, 0x32, 0x08, 0x34, 0xF8, 0x35, 0x10, 0x34, 0x08, 0x32, 0x04, 0x2F, 0x08,
+    0x2B, 0xF8, 0x2D, 0x10, 0x2F, 0x08, 0x30, 0x04, 0x2D, 0x08, 0x2D, 0xF8, 0x2C, 0x10, 0x2D, 0x08,
+    0x2F, 0x04, 0x2C, 0x08, 0x28, 0x04, 0x8A, 0x26, 0x00, 0x30, 0xF8, 0x2F, 0x10, 0x2D, 0x08, 0x2C,
+    0xF8, 0x2A, 0x10, 0x2C, 0x08, 0x2D, 0xFE, 0x37, 0x02, 0x36, 0x10, 0x8D, 0x31, 0x00, 0x81, 0x07,
+    0x00, 0x85, 0x37, 0x00, 0x86, 0x1B, 0x00, 0x92, 0x47, 0x00, 0x8A, 0x4A, 0x00, 0x88, 0x24, 0x00,
+    0x8D, 0x46, 0x00, 0x81, 0x1C, 0x00, 0x85, 0x4C, 0x00, 0x86, 0x30, 0x00,
+};
+static const Song greensleeves_packed_song = {"Greensleeves", nullptr, 136, 70, greensleeves_packed};
+
+// Cannonind: 124 notes, 992 -> 185 bytes
+static const uint8_t cannonind_packed[] = {
+    0x2C, 0x02, 0x2A, 0x02, 0x28, 0x02, 0x27, 0x02, 0x25, 0x02, 0x23, 0x02, 0x25, 0x02, 0x27, 0x02,
+    0x87, 0x10, 0x00, 0x83, 0x0F, 0x00, 0x21, 0x02, 0x20, 0x02, 0x21, 0x02, 0x23, 0x02, 0x28, 0x04,
+    0x2C, 0x08, 0x2D, 0x08, 0x2F, 0x04, 0x82, 0x06, 0x00, 0x25, 0x08, 0x27, 0x08, 0x28, 0x08, 0x2A,
+    0x08, 0x81, 0x11, 0x00, 0x2C, 0x04, 0x81, 0x09, 0x00, 0x2C, 0x04, 0x20, 0x08, 0x21, 0x08, 0x23,
+    0x08, 0x21, 0x08, 0x81, 0x08, 0x00, 0x23, 0x02, 0x21, 0x04, 0x25, 0x08, 0x23, 0x08, 0x21, 0x04,
+    0x20, 0x08, 0x1E, 0x08, 0x20, 0x04, 0x1C, 0x08, 0x1E, 0x08, 0x82, 0x1F, 0x00, 0x25, 0x08, 0x82,
+    0x17, 0x00, 0x25, 0x04, 0x81, 0x39, 0x00, 0x23, 0x08, 0x83, 0x40, 0x00, 0x81, 0x4C, 0x00, 0x2F,
+    0x02, 0x2F, 0x04, 0x82, 0x53, 0x00, 0x81, 0x56, 0x00, 0x2F, 0x08, 0x23, 0x08, 0x83, 0x54, 0x00,
+    0x81, 0x60, 0x00, 0x2C, 0x04, 0x81, 0x58, 0x00, 0x2C, 0x08, 0x27, 0x08, 0x23, 0x08, 0x23, 0x08,
+    0x27, 0x04, 0x25, 0x04, 0x28, 0x08, 0x27, 0x08, 0x25, 0x04, 0x81, 0x5B, 0x00, 0x23, 0x04, 0x81,
+    0x49, 0x00, 0x82, 0x67, 0x00, 0x25, 0x04, 0x82, 0x5F, 0x00, 0x25, 0x04, 0x81, 0x81, 0x00, 0x23,
+    0x08, 0x83, 0x88, 0x00, 0x81, 0x94, 0x00, 0x2F, 0x02,
+};
+static const Song cannonind_packed_song = {"Cannonind", nullptr, 124, 100, cannonind_packed};
+
+// Pacman: 31 notes, 248 -> 51 bytes
+static const uint8_t pacman_packed[] = {
+    0x31, 0x10, 0x3D, 0x10, 0x38, 0x10, 0x35, 0x10, 0x3D, 0x20, 0x38, 0xF0, 0x35, 0x08, 0x32, 0x10,
+    0x3E, 0x10, 0x45, 0x10, 0x42, 0x10, 0x3E, 0x20, 0x45, 0xF0, 0x42, 0x08, 0x86, 0x1C, 0x00, 0x35,
+    0x20, 0x36, 0x20, 0x37, 0x20, 0x37, 0x20, 0x38, 0x20, 0x39, 0x20, 0x39, 0x20, 0x3A, 0x20, 0x3B,
+    0x10, 0x3D, 0x08,
+};
+static const Song pacman_packed_song = {"Pacman", nullptr, 31, 105, pacman_packed};
+
+// Pulodagaita: 207 notes, 1656 -> 229 bytes
+static const uint8_t pulodagaita_packed[] = {
+    0x32, 0x04, 0x2D, 0x08, 0x30, 0x04, 0x2F, 0x08, 0x2D, 0x10, 0x26, 0x08, 0x26, 0x10, 0x2D, 0x10,
+    0x2D, 0x08, 0x2D, 0x10, 0x83, 0x14, 0x00, 0x2D, 0x02, 0x89, 0x19, 0x00, 0x2B, 0x08, 0x2A, 0x08,
+    0x28, 0x08, 0x26, 0x08, 0x26, 0x02, 0x89, 0x26, 0x00, 0x83, 0x29, 0x00, 0x2D, 0x02, 0x89, 0x2E,
+    0x00, 0x83, 0x15, 0x00, 0x26, 0x10, 0x34, 0x08, 0x34, 0x10, 0x34, 0x10, 0x82, 0x06, 0x00, 0x81,
+    0x09, 0x00, 0x32, 0x08, 0x36, 0xF8, 0x32, 0x08, 0x32, 0x10, 0x36, 0x10, 0x36, 0x08, 0x32, 0x10,
+    0x37, 0x08, 0x34, 0x08, 0x34, 0x08, 0x81, 0x12, 0x00, 0x34, 0x10, 0x36, 0x10, 0x34, 0x08, 0x81,
+    0x11, 0x00, 0x37, 0x08, 0x3B, 0x08, 0x39, 0xF8, 0x39, 0x08, 0x32, 0x10, 0x32, 0x10, 0x81, 0x28,
+    0x00, 0x37, 0xF8, 0x81, 0x18, 0x00, 0x32, 0x04, 0x81, 0x0E, 0x00, 0x81, 0x11, 0x00, 0x37, 0x08,
+    0x37, 0x10, 0x84, 0x1E, 0x00, 0x81, 0x3F, 0x00, 0x37, 0x10, 0x36, 0x08, 0x34, 0x10, 0x82, 0x4C,
+    0x00, 0x82, 0x38, 0x00, 0x81, 0x46, 0x00, 0x37, 0x10, 0x84, 0x35, 0x00, 0x81, 0x56, 0x00, 0x37,
+    0x08, 0x81, 0x46, 0x00, 0x32, 0x08, 0x89, 0xA6, 0x00, 0x83, 0xA9, 0x00, 0x2D, 0x02, 0x89, 0xAE,
+    0x00, 0x82, 0x95, 0x00, 0x26, 0xFE, 0x89, 0xB6, 0x00, 0x83, 0xB9, 0x00, 0x2D, 0x02, 0x89, 0xBE,
+    0x00, 0x82, 0xA5, 0x00, 0x26, 0xFE, 0x26, 0x10, 0x81, 0xBE, 0x00, 0x2A, 0x10, 0x2A, 0x08, 0x2A,
+    0x10, 0x2B, 0x10, 0x2B, 0x08, 0x2B, 0x10, 0x2C, 0x10, 0x2C, 0x08, 0x2C, 0x10, 0x2D, 0x08, 0x00,
+    0x08, 0x30, 0x08, 0x32, 0x01,
+};
+static const Song pulodagaita_packed_song = {"Pulodagaita", nullptr, 207, 100, pulodagaita_packed};
+
+// Tetris: 97 notes, 776 -> 123 bytes
+static const uint8_t tetris_packed[] = {
+    0x36, 0x04, 0x31, 0x08, 0x32, 0x08, 0x34, 0x04, 0x32, 0x08, 0x31, 0x08, 0x2F, 0x04, 0x2F, 0x08,
+    0x32, 0x08, 0x36, 0x04, 0x34, 0x08, 0x32, 0x08, 0x31, 0xFC, 0x81, 0x16, 0x00, 0x36, 0x04, 0x32,
+    0x04, 0x2F, 0x04, 0x2F, 0x04, 0x00, 0x04, 0x00, 0x08, 0x34, 0x04, 0x37, 0x08, 0x3B, 0x04, 0x39,
+    0x08, 0x37, 0x08, 0x36, 0xFC, 0x83, 0x25, 0x00, 0x31, 0x04, 0x82, 0x38, 0x00, 0x84, 0x20, 0x00,
+    0x36, 0x02, 0x32, 0x02, 0x34, 0x02, 0x31, 0x02, 0x32, 0x02, 0x2F, 0x02, 0x31, 0x01, 0x83, 0x0E,
+    0x00, 0x32, 0x04, 0x36, 0x04, 0x3B, 0x02, 0x3A, 0x01, 0x8C, 0x59, 0x00, 0x81, 0x58, 0x00, 0x8A,
+    0x42, 0x00, 0x00, 0x08, 0x36, 0x04, 0x83, 0x56, 0x00, 0x00, 0x08, 0x31, 0x04, 0x81, 0x69, 0x00,
+    0x36, 0x04, 0x00, 0x08, 0x32, 0x04, 0x2F, 0x08, 0x81, 0x55, 0x00,
+};
+static const Song tetris_packed_song = {"Tetris", nullptr, 97, 144, tetris_packed};
+
+// Zeldatheme: 110 notes, 880 -> 172 bytes
+static const uint8_t zeldatheme_packed[] = {
+    0x30, 0xFE, 0x2B, 0x08, 0x2B, 0x08, 0x30, 0x08, 0x2E, 0x10, 0x2C, 0x10, 0x2E, 0xFE, 0x30, 0xFE,
+    0x2C, 0x08, 0x2C, 0x08, 0x30, 0x08, 0x2F, 0x10, 0x2D, 0x10, 0x2F, 0xFE, 0x00, 0x01, 0x30, 0x04,
+    0x2B, 0xFC, 0x30, 0x08, 0x30, 0x10, 0x32, 0x10, 0x34, 0x10, 0x35, 0x10, 0x37, 0x02, 0x37, 0x08,
+    0x37, 0x08, 0x37, 0x08, 0x38, 0x10, 0x3A, 0x10, 0x3C, 0xFE, 0x3C, 0x08, 0x3C, 0x08, 0x3A, 0x08,
+    0x38, 0x10, 0x3A, 0xF8, 0x38, 0x10, 0x37, 0x02, 0x37, 0x04, 0x35, 0xF8, 0x37, 0x10, 0x38, 0x02,
+    0x37, 0x08, 0x35, 0x08, 0x33, 0xF8, 0x81, 0x2C, 0x00, 0x35, 0x08, 0x33, 0x08, 0x32, 0xF8, 0x34,
+    0x10, 0x36, 0x02, 0x39, 0x08, 0x37, 0x10, 0x2B, 0x10, 0x2B, 0x10, 0x81, 0x04, 0x00, 0x81, 0x07,
+    0x00, 0x2B, 0x10, 0x2B, 0x08, 0x81, 0x04, 0x00, 0x8D, 0x5A, 0x00, 0x3F, 0x04, 0x3E, 0x04, 0x3B,
+    0x02, 0x37, 0x04, 0x38, 0xFE, 0x3C, 0x04, 0x3B, 0x04, 0x81, 0x43, 0x00, 0x82, 0x09, 0x00, 0x37,
+    0x02, 0x34, 0x04, 0x35, 0xFE, 0x38, 0x04, 0x37, 0x04, 0x33, 0x02, 0x30, 0x04, 0x86, 0x40, 0x00,
+    0x81, 0x39, 0x00, 0x81, 0x3C, 0x00, 0x81, 0x35, 0x00, 0x81, 0x38, 0x00,
+};
+static const Song zeldatheme_packed_song = {"Zeldatheme", nullptr, 110, 88, zeldatheme_packed};
+
+// Thebadinerie: 241 notes, 1928 -> 418 bytes
+static const uint8_t thebadinerie_packed[] = {
+    0x3D, 0xF8, 0x40, 0x10, 0x3D, 0x10, 0x38, 0xF8, 0x3D, 0x10, 0x38, 0x10, 0x34, 0xF8, 0x38, 0x10,
+    0x34, 0x10, 0x31, 0x04, 0x2B, 0x10, 0x31, 0x10, 0x34, 0x10, 0x31, 0x10, 0x33, 0x10, 0x81, 0x04,
+    0x00, 0x31, 0x10, 0x30, 0x10, 0x33, 0x10, 0x36, 0x10, 0x33, 0x10, 0x34, 0x08, 0x31, 0x08, 0x89,
+    0x2F, 0x00, 0x34, 0x10, 0x33, 0xF0, 0x34, 0xF8, 0x82, 0x06, 0x00, 0x3D, 0xF8, 0x34, 0xF8, 0x34,
+    0x08, 0x33, 0xF8, 0x38, 0xF0, 0x37, 0x10, 0x38, 0xF8, 0x82, 0x06, 0x00, 0x40, 0xF8, 0x38, 0xF8,
+    0x38, 0x08, 0x37, 0x08, 0x33, 0x10, 0x38, 0x10, 0x3B, 0x10, 0x38, 0x10, 0x3A, 0x10, 0x81, 0x04,
+    0x00, 0x38, 0x10, 0x37, 0x10, 0x39, 0x10, 0x3D, 0x10, 0x39, 0x10, 0x3B, 0x10, 0x3A, 0x10, 0x3B,
+    0x10, 0x39, 0x10, 0x37, 0x10, 0x81, 0x1D, 0x00, 0x37, 0x10, 0x38, 0x10, 0x81, 0x74, 0x00, 0x81,
+    0x07, 0x00, 0x3E, 0x10, 0x38, 0x10, 0x36, 0x10, 0x38, 0x10, 0x40, 0x10, 0x81, 0x2B, 0x00, 0x81,
+    0x07, 0x00, 0x3E, 0x10, 0x3D, 0x10, 0x3E, 0x10, 0x81, 0x2D, 0x00, 0x38, 0x10, 0x3B, 0x08, 0x39,
+    0x08, 0x38, 0x04, 0x00, 0x04, 0x38, 0xF8, 0x81, 0x4F, 0x00, 0x33, 0xFC, 0x38, 0x10, 0x33, 0x10,
+    0x2F, 0xF8, 0x33, 0x10, 0x2F, 0x10, 0x2B, 0x04, 0x32, 0x08, 0x31, 0x08, 0x36, 0x08, 0x35, 0x10,
+    0x81, 0x25, 0x00, 0x3A, 0x10, 0x38, 0x10, 0x3A, 0x08, 0x34, 0x08, 0x3A, 0xF8, 0x3D, 0x10, 0x3A,
+    0x08, 0x36, 0xF8, 0x3A, 0x10, 0x36, 0x10, 0x33, 0xF8, 0x81, 0xB2, 0x00, 0x2F, 0x04, 0x2F, 0x10,
+    0x34, 0x10, 0x81, 0xD4, 0x00, 0x36, 0x10, 0x34, 0x10, 0x81, 0x04, 0x00, 0x81, 0xC7, 0x00, 0x39,
+    0x10, 0x81, 0x6B, 0x00, 0x81, 0x6E, 0x00, 0x81, 0x12, 0x00, 0x81, 0xEC, 0x00, 0x33, 0x10, 0x34,
+    0x10, 0x39, 0x10, 0x34, 0x10, 0x81, 0x08, 0x00, 0x3B, 0x10, 0x34, 0x10, 0x81, 0x0F, 0x00, 0x3D,
+    0x10, 0x34, 0x10, 0x81, 0x16, 0x00, 0x3D, 0x10, 0x81, 0xA9, 0x00, 0x81, 0xC3, 0x00, 0x81, 0x39,
+    0x00, 0x38, 0x08, 0x36, 0x10, 0x34, 0x04, 0x81, 0xA3, 0x00, 0x38, 0xF8, 0x81, 0xA8, 0x00, 0x38,
+    0xF8, 0x82, 0xE5, 0x00, 0x36, 0x08, 0x81, 0x51, 0x00, 0x36, 0xF8, 0x81, 0x56, 0x00, 0x36, 0xF8,
+    0x40, 0xF8, 0x36, 0xF8, 0x36, 0x08, 0x34, 0x08, 0x82, 0x48, 0x01, 0x3D, 0x08, 0x39, 0x04, 0x39,
+    0x04, 0x3D, 0x20, 0x3B, 0x20, 0x39, 0x20, 0x38, 0x20, 0x36, 0x04, 0x36, 0x08, 0x81, 0x08, 0x00,
+    0x36, 0x20, 0x34, 0x20, 0x32, 0x10, 0x36, 0x10, 0x39, 0x10, 0x81, 0x43, 0x01, 0x81, 0x53, 0x01,
+    0x2F, 0x10, 0x30, 0xF8, 0x2F, 0xF8, 0x2D, 0x08, 0x2B, 0x08, 0x2F, 0x08, 0x81, 0x59, 0x01, 0x36,
+    0x08, 0x34, 0x10, 0x81, 0x5A, 0x01, 0x31, 0x20, 0x33, 0x20, 0x34, 0x20, 0x36, 0x20, 0x38, 0x08,
+    0x34, 0x10, 0x38, 0x10, 0x3D, 0x08, 0x81, 0x75, 0x00, 0x34, 0x10, 0x81, 0x9E, 0x00, 0x33, 0x08,
+    0x31, 0x04,
+};
+static const Song thebadinerie_packed_song = {"Thebadinerie", nullptr, 241, 120, thebadinerie_packed};
+
+// Silentnight: 47 notes, 376 -> 71 bytes
+static const uint8_t silentnight_packed[] = {
+    0x2D, 0xFC, 0x2F, 0x08, 0x2D, 0x04, 0x2A, 0xFE, 0x83, 0x08, 0x00, 0x34, 0x02, 0x34, 0x04, 0x31,
+    0xFE, 0x32, 0x02, 0x32, 0x04, 0x2D, 0xFE, 0x2F, 0x02, 0x2F, 0x04, 0x32, 0xFC, 0x31, 0x08, 0x2F,
+    0x04, 0x83, 0x21, 0x00, 0x84, 0x0D, 0x00, 0x83, 0x27, 0x00, 0x81, 0x1F, 0x00, 0x37, 0xFC, 0x34,
+    0x08, 0x31, 0x04, 0x32, 0xFE, 0x36, 0xFE, 0x32, 0x04, 0x2D, 0x04, 0x2A, 0x04, 0x2D, 0xFC, 0x2B,
+    0x08, 0x28, 0x04, 0x26, 0xFE, 0x26, 0xFF,
+};
+static const Song silentnight_packed_song = {"Silentnight", nullptr, 47, 140, silentnight_packed};
+
+// Thelick: 7 notes, 56 -> 14 bytes
+static const uint8_t thelick_packed[] = {
+    0x28, 0x08, 0x2A, 0x08, 0x2B, 0x08, 0x2D, 0x08, 0x2A, 0x04, 0x26, 0x08, 0x28, 0x01,
+};
+static const Song thelick_packed_song = {"Thelick", nullptr, 7, 108, thelick_packed};
+
+// Startrekintro: 8 notes, 64 -> 16 bytes
+static const uint8_t startrekintro_packed[] = {
+    0x28, 0xF8, 0x2D, 0x10, 0x32, 0xFC, 0x31, 0x08, 0x2D, 0xF0, 0x2A, 0xF0, 0x2F, 0xF0, 0x34, 0x02,
+};
+static const Song startrekintro_packed_song = {"Startrekintro", nullptr, 8, 80, startrekintro_packed};
+
+// Thegodfather: 129 notes, 1032 -> 165 bytes
+static const uint8_t thegodfather_packed[] = {
+    0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x2A, 0x08, 0x2F, 0x08, 0x32, 0x08, 0x31, 0x08,
+    0x81, 0x06, 0x00, 0x2F, 0x08, 0x31, 0x08, 0x2F, 0x08, 0x2B, 0x08, 0x2D, 0x08, 0x2A, 0x02, 0x83,
+    0x17, 0x00, 0x81, 0x18, 0x00, 0x81, 0x1B, 0x00, 0x2F, 0x08, 0x2A, 0x08, 0x29, 0x08, 0x28, 0x02,
+    0x28, 0x08, 0x2B, 0x08, 0x2E, 0x08, 0x31, 0x02, 0x82, 0x08, 0x00, 0x2F, 0x02, 0x26, 0x08, 0x26,
+    0x08, 0x2D, 0x08, 0x2B, 0x08, 0x2A, 0x08, 0x81, 0x06, 0x00, 0x81, 0x07, 0x00, 0x2A, 0x08, 0x2E,
+    0x08, 0x2F, 0x02, 0x00, 0x08, 0x2F, 0x08, 0x2F, 0x08, 0x2E, 0x08, 0x2D, 0x02, 0x82, 0x48, 0x00,
+    0x2A, 0x02, 0x2A, 0x08, 0x2D, 0x08, 0x2A, 0x08, 0x81, 0x3A, 0x00, 0x81, 0x3B, 0x00, 0x29, 0x08,
+    0x2A, 0x02, 0x84, 0x6C, 0x00, 0x81, 0x6B, 0x00, 0x85, 0x65, 0x00, 0x83, 0x73, 0x00, 0x81, 0x74,
+    0x00, 0x81, 0x77, 0x00, 0x87, 0x5C, 0x00, 0x82, 0x57, 0x00, 0x85, 0x4F, 0x00, 0x81, 0x4C, 0x00,
+    0x81, 0x4D, 0x00, 0x87, 0x46, 0x00, 0x82, 0x81, 0x00, 0x83, 0x39, 0x00, 0x81, 0x6E, 0x00, 0x81,
+    0x6F, 0x00, 0x81, 0x34, 0x00,
+};
+static const Song thegodfather_packed_song = {"Thegodfather", nullptr, 129, 80, thegodfather_packed};
+
+// Pinkpanther: 88 notes, 704 -> 120 bytes
+static const uint8_t pinkpanther_packed[] = {
+    0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x29, 0x08, 0x2A, 0xFC, 0x00, 0x08, 0x2C, 0x08, 0x2D, 0xFC,
+    0x81, 0x0C, 0x00, 0x2A, 0xF8, 0x2C, 0x08, 0x2D, 0xF8, 0x32, 0x08, 0x31, 0xF8, 0x2A, 0x08, 0x2D,
+    0xF8, 0x31, 0x08, 0x30, 0x02, 0x2F, 0xF0, 0x2D, 0xF0, 0x2A, 0xF0, 0x28, 0xF0, 0x2A, 0x02, 0x81,
+    0x2D, 0x00, 0x29, 0x04, 0x83, 0x2C, 0x00, 0x81, 0x33, 0x00, 0x84, 0x27, 0x00, 0x2D, 0x08, 0x31,
+    0xF8, 0x36, 0x08, 0x35, 0x01, 0x34, 0x02, 0x86, 0x45, 0x00, 0x81, 0x46, 0x00, 0x8C, 0x3A, 0x00,
+    0x2A, 0xFC, 0x00, 0x04, 0x00, 0x04, 0x36, 0xF8, 0x34, 0x08, 0x31, 0xF8, 0x2F, 0x08, 0x2D, 0xF8,
+    0x2A, 0xF8, 0x30, 0x10, 0x2F, 0xF8, 0x81, 0x04, 0x00, 0x81, 0x07, 0x00, 0x81, 0x0A, 0x00, 0x82,
+    0x48, 0x00, 0x2A, 0x10, 0x2A, 0x10, 0x2A, 0x02,
+};
+static const Song pinkpanther_packed_song = {"Pinkpanther", nullptr, 88, 120, pinkpanther_packed};
+
+// Takeonme: 96 notes, 768 -> 125 bytes
+static const uint8_t takeonme_packed[] = {
+    0x38, 0x08, 0x38, 0x08, 0x34, 0x08, 0x31, 0x08, 0x00, 0x08, 0x81, 0x04, 0x00, 0x36, 0x08, 0x00,
+    0x08, 0x81, 0x04, 0x00, 0x36, 0x08, 0x3A, 0x08, 0x3A, 0x08, 0x3B, 0x08, 0x3D, 0x08, 0x3B, 0x08,
+    0x3B, 0x08, 0x3B, 0x08, 0x81, 0x17, 0x00, 0x34, 0x08, 0x00, 0x08, 0x38, 0x08, 0x81, 0x04, 0x00,
+    0x81, 0x07, 0x00, 0x36, 0x08, 0x36, 0x08, 0x38, 0x08, 0x81, 0x04, 0x00, 0x83, 0x3A, 0x00, 0x81,
+    0x39, 0x00, 0x81, 0x35, 0x00, 0x81, 0x38, 0x00, 0x87, 0x34, 0x00, 0x81, 0x3E, 0x00, 0x82, 0x27,
+    0x00, 0x81, 0x28, 0x00, 0x81, 0x2B, 0x00, 0x82, 0x24, 0x00, 0x81, 0x25, 0x00, 0x83, 0x5B, 0x00,
+    0x81, 0x5A, 0x00, 0x81, 0x56, 0x00, 0x81, 0x59, 0x00, 0x87, 0x55, 0x00, 0x81, 0x5F, 0x00, 0x82,
+    0x48, 0x00, 0x81, 0x49, 0x00, 0x81, 0x4C, 0x00, 0x82, 0x45, 0x00, 0x36, 0x08,
+};
+static const Song takeonme_packed_song = {"Takeonme", nullptr, 96, 140, takeonme_packed};
+
+// Cantinaband: 64 notes, 512 -> 104 bytes
+static const uint8_t cantinaband_packed[] = {
+    0x31, 0xFC, 0x36, 0xFC, 0x81, 0x04, 0x00, 0x31, 0x08, 0x36, 0xFC, 0x31, 0x08, 0x00, 0x08, 0x30,
+    0x08, 0x31, 0x08, 0x31, 0x08, 0x81, 0x06, 0x00, 0x2F, 0x08, 0x00, 0x08, 0x2E, 0x08, 0x2F, 0x08,
+    0x2D, 0x08, 0x2D, 0x04, 0x2A, 0xFE, 0x81, 0x26, 0x00, 0x81, 0x29, 0x00, 0x85, 0x25, 0x00, 0x2F,
+    0xFC, 0x2F, 0xFC, 0x2E, 0x08, 0x2F, 0xFC, 0x34, 0x08, 0x32, 0xFC, 0x31, 0xFC, 0x2F, 0xFC, 0x81,
+    0x3F, 0x00, 0x81, 0x42, 0x00, 0x85, 0x3E, 0x00, 0x34, 0x04, 0x34, 0xFC, 0x31, 0x08, 0x2F, 0xFC,
+    0x2D, 0xFC, 0x2A, 0xFE, 0x2A, 0x02, 0x2D, 0x02, 0x31, 0x02, 0x34, 0x02, 0x37, 0xFC, 0x36, 0xFC,
+    0x30, 0x08, 0x30, 0x08, 0x31, 0x04, 0x2D, 0x04,
+};
+static const Song cantinaband_packed_song = {"Cantinaband", nullptr, 64, 140, cantinaband_packed};
+
+// Babyelephantwalk: 68 notes, 544 -> 101 bytes
+static const uint8_t babyelephantwalk_packed[] = {
+    0x26, 0xF8, 0x2A, 0x10, 0x2D, 0x08, 0x32, 0x08, 0x36, 0x08, 0x34, 0x08, 0x32, 0x08, 0x2F, 0x08,
+    0x2C, 0x08, 0x2D, 0x08, 0x00, 0x04, 0x00, 0x02, 0x87, 0x18, 0x00, 0x2D, 0xFE, 0x2F, 0x08, 0x29,
+    0x01, 0x2F, 0x08, 0x2A, 0x08, 0x26, 0x08, 0x81, 0x13, 0x00, 0x8A, 0x2A, 0x00, 0x00, 0x04, 0x00,
+    0x08, 0x2D, 0x08, 0x34, 0x04, 0x34, 0x04, 0x31, 0x08, 0x2D, 0x08, 0x81, 0x0C, 0x00, 0x32, 0x04,
+    0x32, 0x04, 0x30, 0x10, 0x32, 0x10, 0x30, 0x10, 0x2D, 0x10, 0x2B, 0x08, 0x29, 0x08, 0x2C, 0x04,
+    0x2C, 0x04, 0x2B, 0x10, 0x2D, 0x10, 0x2B, 0x10, 0x29, 0x10, 0x26, 0x08, 0x2D, 0x08, 0x30, 0x08,
+    0x32, 0x08, 0x81, 0x4E, 0x00,
+};
+static const Song babyelephantwalk_packed_song = {"Babyelephantwalk", nullptr, 68, 132, babyelephantwalk_packed};
+
+// Vampirekiller: 252 notes, 2016 -> 235 bytes
+static const uint8_t vampirekiller_packed[] = {
+    0x36, 0x10, 0x36, 0x08, 0x34, 0x10, 0x00, 0x10, 0x33, 0xFC, 0x2A, 0x08, 0x2C, 0x10, 0x2D, 0x10,
+    0x2F, 0x10, 0x31, 0xF8, 0x2A, 0xF8, 0x31, 0x08, 0x2F, 0x10, 0x34, 0xFC, 0x8C, 0x1C, 0x00, 0x28,
+    0xFC, 0x00, 0x08, 0x36, 0x08, 0x00, 0x10, 0x3D, 0x10, 0x00, 0x08, 0x3C, 0x10, 0x3D, 0x10, 0x3C,
+    0x10, 0x39, 0x10, 0x00, 0x04, 0x3D, 0x08, 0x81, 0x0A, 0x00, 0x00, 0x10, 0x3C, 0x10, 0x3B, 0x10,
+    0x81, 0x1B, 0x00, 0x39, 0x10, 0x81, 0x18, 0x00, 0x81, 0x23, 0x00, 0x3B, 0x10, 0x39, 0x10, 0x8A,
+    0x2E, 0x00, 0x81, 0x25, 0x00, 0x82, 0x1B, 0x00, 0x81, 0x33, 0x00, 0x39, 0x10, 0x81, 0x30, 0x00,
+    0x81, 0x3B, 0x00, 0x81, 0x18, 0x00, 0x29, 0xF8, 0x2C, 0xF8, 0x32, 0x08, 0x31, 0xF8, 0x2D, 0xF8,
+    0x2A, 0x08, 0x84, 0x0C, 0x00, 0x00, 0x08, 0x85, 0x11, 0x00, 0x83, 0x14, 0x00, 0x33, 0xF8, 0x35,
+    0x08, 0x36, 0x10, 0x36, 0x10, 0x2A, 0x10, 0x2A, 0xFE, 0x26, 0x08, 0x26, 0x08, 0x2A, 0x10, 0x2D,
+    0xF8, 0x28, 0x08, 0x28, 0x08, 0x2C, 0x10, 0x2F, 0xF8, 0x89, 0x18, 0x00, 0x25, 0x10, 0x28, 0xF8,
+    0x8D, 0xA0, 0x00, 0x8C, 0xA3, 0x00, 0x8B, 0x87, 0x00, 0x81, 0x7C, 0x00, 0x82, 0x72, 0x00, 0x81,
+    0x8A, 0x00, 0x39, 0x10, 0x81, 0x87, 0x00, 0x81, 0x92, 0x00, 0x81, 0x6F, 0x00, 0x8A, 0x9C, 0x00,
+    0x81, 0x93, 0x00, 0x82, 0x89, 0x00, 0x81, 0xA1, 0x00, 0x39, 0x10, 0x81, 0x9E, 0x00, 0x81, 0xA9,
+    0x00, 0x81, 0x86, 0x00, 0x85, 0x6E, 0x00, 0x84, 0x71, 0x00, 0x00, 0x08, 0x85, 0x76, 0x00, 0x83,
+    0x79, 0x00, 0x8D, 0x65, 0x00, 0x89, 0x64, 0x00, 0x81, 0x4C, 0x00,
+};
+static const Song vampirekiller_packed_song = {"Vampirekiller", nullptr, 252, 130, vampirekiller_packed};
+
+// Princeigor: 138 notes, 1104 -> 207 bytes
+static const uint8_t princeigor_packed[] = {
+    0x2D, 0x04, 0x2D, 0x04, 0x34, 0xFE, 0x32, 0x08, 0x34, 0x08, 0x30, 0x04, 0x2F, 0x08, 0x2D, 0x08,
+    0x2F, 0x08, 0x30, 0x08, 0x32, 0x01, 0x34, 0x04, 0x2F, 0x04, 0x2D, 0x08, 0x2B, 0x08, 0x28, 0x04,
+    0x28, 0x04, 0x2D, 0xFE, 0x2F, 0x04, 0x2D, 0x04, 0x2B, 0x08, 0x2A, 0x08, 0x2B, 0x04, 0x2A, 0x04,
+    0x28, 0x01, 0x2A, 0x04, 0x2B, 0x04, 0x81, 0x12, 0x00, 0x2D, 0x04, 0x30, 0xFE, 0x32, 0x04, 0x82,
+    0x35, 0x00, 0x2F, 0x04, 0x30, 0x04, 0x32, 0xFE, 0x33, 0x04, 0x32, 0x04, 0x2F, 0x04, 0x33, 0x04,
+    0x27, 0x04, 0x37, 0xFE, 0x39, 0x04, 0x37, 0x04, 0x29, 0x08, 0x27, 0x08, 0x37, 0x02, 0x32, 0xFE,
+    0x30, 0x04, 0x32, 0x04, 0x30, 0x08, 0x2F, 0x08, 0x81, 0x68, 0x00, 0x30, 0x01, 0x32, 0x04, 0x82,
+    0x65, 0x00, 0x2B, 0x04, 0x2D, 0x04, 0x2F, 0x01, 0x30, 0x04, 0x2F, 0x04, 0x81, 0x0A, 0x00, 0x81,
+    0x7D, 0x00, 0x32, 0x04, 0x82, 0x7A, 0x00, 0x2F, 0xFF, 0x2F, 0xFF, 0x00, 0x02, 0x8A, 0x8D, 0x00,
+    0x81, 0x8A, 0x00, 0x82, 0x31, 0x00, 0x82, 0x78, 0x00, 0x81, 0x8B, 0x00, 0x82, 0x76, 0x00, 0x81,
+    0x77, 0x00, 0x28, 0xFE, 0x00, 0x04, 0x81, 0xA0, 0x00, 0x82, 0x47, 0x00, 0x81, 0xAC, 0x00, 0x31,
+    0xFE, 0x32, 0x04, 0x82, 0xA9, 0x00, 0x81, 0x92, 0x00, 0x2B, 0xFF, 0x00, 0x04, 0x87, 0xBD, 0x00,
+    0x81, 0x9C, 0x00, 0x2B, 0xFE, 0x81, 0xA1, 0x00, 0x2B, 0xFE, 0x81, 0xA6, 0x00, 0x2B, 0xFF,
+};
+static const Song princeigor_packed_song = {"Princeigor", nullptr, 138, 110, princeigor_packed};
+
+// Brahmslullaby: 54 notes, 432 -> 92 bytes
+static const uint8_t brahmslullaby_packed[] = {
+    0x2D, 0x04, 0x2D, 0x04, 0x30, 0xFC, 0x2D, 0x08, 0x2D, 0x04, 0x30, 0x04, 0x00, 0x04, 0x2D, 0x08,
+    0x30, 0x08, 0x35, 0x04, 0x34, 0xFC, 0x32, 0x08, 0x32, 0x04, 0x30, 0x04, 0x2B, 0x08, 0x2D, 0x08,
+    0x2E, 0x04, 0x2B, 0x04, 0x82, 0x08, 0x00, 0x00, 0x04, 0x2B, 0x08, 0x2E, 0x08, 0x34, 0x08, 0x32,
+    0x08, 0x30, 0x04, 0x34, 0x04, 0x35, 0x04, 0x00, 0x04, 0x29, 0x08, 0x29, 0x08, 0x35, 0x02, 0x32,
+    0x08, 0x2E, 0x08, 0x30, 0x02, 0x2D, 0x08, 0x29, 0x08, 0x2E, 0x04, 0x30, 0x04, 0x32, 0x04, 0x30,
+    0x02, 0x87, 0x18, 0x00, 0x30, 0x04, 0x2D, 0x04, 0x29, 0x04, 0x29, 0x02,
+};
+static const Song brahmslullaby_packed_song = {"Brahmslullaby", nullptr, 54, 76, brahmslullaby_packed};
+
+// Zeldaslullaby: 48 notes, 384 -> 72 bytes
+static const uint8_t zeldaslullaby_packed[] = {
+    0x2A, 0x02, 0x2D, 0x04, 0x28, 0x02, 0x26, 0x08, 0x28, 0x08, 0x81, 0x0A, 0x00, 0x28, 0xFE, 0x81,
+    0x0F, 0x00, 0x34, 0x02, 0x32, 0x04, 0x2D, 0x02, 0x2B, 0x08, 0x2A, 0x08, 0x28, 0xFE, 0x84, 0x1E,
+    0x00, 0x81, 0x21, 0x00, 0x28, 0xFE, 0x81, 0x26, 0x00, 0x84, 0x17, 0x00, 0x81, 0x14, 0x00, 0x26,
+    0x02, 0x2B, 0x02, 0x2A, 0x08, 0x28, 0x08, 0x81, 0x04, 0x00, 0x23, 0x02, 0x82, 0x26, 0x00, 0x81,
+    0x27, 0x00, 0x26, 0x04, 0x2B, 0x04, 0x32, 0xFE,
+};
+static const Song zeldaslullaby_packed_song = {"Zeldaslullaby", nullptr, 48, 108, zeldaslullaby_packed};
+
+// Imperialmarch: 86 notes, 688 -> 114 bytes
+static const uint8_t imperialmarch_packed[] = {
+    0x2F, 0xFC, 0x2F, 0xFC, 0x2F, 0x10, 0x2F, 0x10, 0x81, 0x04, 0x00, 0x2B, 0x08, 0x00, 0x08, 0x83,
+    0x0F, 0x00, 0x81, 0x0E, 0x00, 0x81, 0x0A, 0x00, 0x2F, 0x04, 0x2F, 0x04, 0x2F, 0x04, 0x2B, 0xF8,
+    0x32, 0x10, 0x82, 0x06, 0x00, 0x2F, 0x02, 0x36, 0x04, 0x36, 0x04, 0x36, 0x04, 0x37, 0xF8, 0x32,
+    0x10, 0x82, 0x15, 0x00, 0x2F, 0x02, 0x3B, 0x04, 0x2F, 0xF8, 0x2F, 0x10, 0x3B, 0x04, 0x3A, 0xF8,
+    0x39, 0x10, 0x35, 0x10, 0x34, 0x10, 0x35, 0x08, 0x00, 0x08, 0x2F, 0x08, 0x35, 0x04, 0x34, 0xF8,
+    0x33, 0x10, 0x32, 0x10, 0x31, 0x10, 0x32, 0x10, 0x00, 0x08, 0x2B, 0x08, 0x2E, 0x04, 0x2B, 0xF8,
+    0x2F, 0xF0, 0x32, 0x04, 0x2F, 0xF8, 0x32, 0x10, 0x36, 0x02, 0x95, 0x34, 0x00, 0x82, 0x51, 0x00,
+    0x2F, 0x02,
+};
+static const Song imperialmarch_packed_song = {"Imperialmarch", nullptr, 86, 120, imperialmarch_packed};
+
+// Harrypotter: 62 notes, 496 -> 93 bytes
+static const uint8_t harrypotter_packed[] = {
+    0x00, 0x02, 0x28, 0x04, 0x2D, 0xFC, 0x30, 0x08, 0x2F, 0x04, 0x2D, 0x02, 0x34, 0x04, 0x32, 0xFE,
+    0x2F, 0xFE, 0x82, 0x0E, 0x00, 0x2B, 0x02, 0x2E, 0x04, 0x28, 0xFF, 0x85, 0x19, 0x00, 0x37, 0x02,
+    0x36, 0x04, 0x35, 0x02, 0x31, 0x04, 0x35, 0xFC, 0x34, 0x08, 0x33, 0x04, 0x27, 0x02, 0x31, 0x04,
+    0x2D, 0xFF, 0x30, 0x04, 0x34, 0x02, 0x81, 0x04, 0x00, 0x30, 0x04, 0x35, 0x02, 0x34, 0x04, 0x33,
+    0x02, 0x2F, 0x04, 0x30, 0xFC, 0x82, 0x1D, 0x00, 0x28, 0x04, 0x34, 0xFF, 0x00, 0x04, 0x81, 0x1C,
+    0x00, 0x81, 0x1F, 0x00, 0x30, 0x04, 0x87, 0x38, 0x00, 0x30, 0x04, 0x2D, 0xFF,
+};
+static const Song harrypotter_packed_song = {"Harrypotter", nullptr, 62, 144, harrypotter_packed};
+
+// Jigglypuffsong: 38 notes, 304 -> 35 bytes
+static const uint8_t jigglypuffsong_packed[] = {
+    0x34, 0xFC, 0x3B, 0x08, 0x38, 0x08, 0x34, 0x08, 0x36, 0xFC, 0x38, 0x08, 0x39, 0x04, 0x38, 0xFC,
+    0x36, 0x08, 0x38, 0x04, 0x34, 0xFE, 0x86, 0x16, 0x00, 0x38, 0xFF, 0x8A, 0x1B, 0x00, 0x86, 0x1E,
+    0x00, 0x38, 0xFF,
+};
+static const Song jigglypuffsong_packed_song = {"Jigglypuffsong", nullptr, 38, 85, jigglypuffsong_packed};
+
+// Happybirthday: 25 notes, 200 -> 42 bytes
+static const uint8_t happybirthday_packed[] = {
+    0x26, 0x04, 0x26, 0x08, 0x28, 0xFC, 0x26, 0xFC, 0x2B, 0xFC, 0x2A, 0xFE, 0x83, 0x0C, 0x00, 0x2D,
+    0xFC, 0x2B, 0xFE, 0x81, 0x13, 0x00, 0x32, 0xFC, 0x2F, 0xFC, 0x2B, 0xFC, 0x2A, 0xFC, 0x28, 0xFC,
+    0x30, 0x04, 0x30, 0x08, 0x81, 0x0C, 0x00, 0x81, 0x18, 0x00,
+};
+static const uint8_t happybirthday_rows[] = {
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x1A, 0x1E, 0x21, 0x1F, 0xFF, 0xFF, 0x1F, 0x23,
+    0x26, 0x18, 0xFF, 0xFF, 0xFF, 0x1A, 0xFF, 0x1E, 0x1F,
+};
+static const SongTracks happybirthday_tracks = {1, nullptr, happybirthday_rows};
+static const Song happybirthday_packed_song = {"Happybirthday", nullptr, 25, 140, happybirthday_packed, &happybirthday_tracks};
+
+// Bloodytears: 677 notes, 5416 -> 856 bytes
+static const uint8_t bloodytears_packed[] = {
+    0x00, 0x04, 0x39, 0x04, 0x3B, 0x04, 0x3C, 0x04, 0x3B, 0x04, 0x37, 0x04, 0x3B, 0x04, 0x39, 0x04,
+    0x83, 0x10, 0x00, 0x3E, 0x04, 0x81, 0x0F, 0x00, 0x39, 0x04, 0x87, 0x1A, 0x00, 0x40, 0x04, 0x00,
+    0x08, 0x3E, 0x08, 0x00, 0x04, 0x81, 0x1F, 0x00, 0x3C, 0x08, 0x3E, 0x08, 0x43, 0x08, 0x00, 0x08,
+    0x00, 0x04, 0x39, 0x10, 0x34, 0x10, 0x40, 0x10, 0x34, 0x10, 0x3E, 0x10, 0x34, 0x10, 0x3C, 0x10,
+    0x34, 0x10, 0x3B, 0x10, 0x83, 0x08, 0x00, 0x34, 0x10, 0x81, 0x17, 0x00, 0x3B, 0x10, 0x82, 0x12,
+    0x00, 0x84, 0x17, 0x00, 0x34, 0x10, 0x37, 0x10, 0x81, 0x18, 0x00, 0x34, 0x10, 0x81, 0x2B, 0x00,
+    0x88, 0x2E, 0x00, 0x83, 0x27, 0x00, 0x83, 0x2A, 0x00, 0x82, 0x2D, 0x00, 0x84, 0x32, 0x00, 0x81,
+    0x1B, 0x00, 0x81, 0x32, 0x00, 0x34, 0x10, 0x81, 0x45, 0x00, 0x88, 0x48, 0x00, 0x83, 0x41, 0x00,
+    0x34, 0x10, 0x81, 0x50, 0x00, 0x3B, 0x10, 0x82, 0x4B, 0x00, 0x84, 0x50, 0x00, 0x81, 0x39, 0x00,
+    0x81, 0x50, 0x00, 0x34, 0x10, 0x81, 0x63, 0x00, 0x81, 0x5A, 0x00, 0x86, 0x65, 0x00, 0x83, 0x62,
+    0x00, 0x34, 0x10, 0x81, 0x71, 0x00, 0x3B, 0x10, 0x82, 0x6C, 0x00, 0x84, 0x71, 0x00, 0x81, 0x5A,
+    0x00, 0x81, 0x71, 0x00, 0x34, 0x10, 0x81, 0x84, 0x00, 0x3E, 0x10, 0x3E, 0x10, 0x43, 0x10, 0x40,
+    0x08, 0x00, 0x10, 0x81, 0x95, 0x00, 0x3E, 0x10, 0x3C, 0x10, 0x3E, 0xF8, 0x43, 0xF8, 0x40, 0xFC,
+    0x3E, 0x08, 0x81, 0xAA, 0x00, 0x82, 0x18, 0x00, 0x81, 0xAA, 0x00, 0x3E, 0x08, 0x40, 0x08, 0x41,
+    0xF8, 0x43, 0xF8, 0x40, 0xF8, 0x00, 0x10, 0x41, 0x08, 0x81, 0xCA, 0x00, 0x82, 0x2F, 0x00, 0x81,
+    0xC1, 0x00, 0x3E, 0x08, 0x3C, 0x08, 0x83, 0x2C, 0x00, 0x81, 0xD1, 0x00, 0x82, 0x3F, 0x00, 0x81,
+    0xD1, 0x00, 0x83, 0x27, 0x00, 0x34, 0x08, 0x38, 0x08, 0x37, 0x08, 0x3B, 0x08, 0x3B, 0xF8, 0x39,
+    0xFC, 0x81, 0x04, 0x00, 0x81, 0x07, 0x00, 0x3C, 0x08, 0x3B, 0x08, 0x39, 0x08, 0x37, 0x08, 0x3B,
+    0xF8, 0x39, 0xF8, 0x34, 0x08, 0x82, 0x06, 0x00, 0x82, 0x09, 0x00, 0x3C, 0x04, 0x3E, 0x04, 0x81,
+    0x2B, 0x01, 0x88, 0x00, 0x01, 0x83, 0xF9, 0x00, 0x34, 0x10, 0x81, 0x08, 0x01, 0x3B, 0x10, 0x82,
+    0x03, 0x01, 0x84, 0x08, 0x01, 0x81, 0xF1, 0x00, 0x81, 0x08, 0x01, 0x34, 0x10, 0x81, 0x1B, 0x01,
+    0x88, 0x1E, 0x01, 0x83, 0x17, 0x01, 0x83, 0x1A, 0x01, 0x82, 0x1D, 0x01, 0x84, 0x22, 0x01, 0x81,
+    0x0B, 0x01, 0x81, 0x22, 0x01, 0x34, 0x10, 0x81, 0x35, 0x01, 0x88, 0x38, 0x01, 0x83, 0x31, 0x01,
+    0x34, 0x10, 0x81, 0x40, 0x01, 0x3B, 0x10, 0x82, 0x3B, 0x01, 0x84, 0x40, 0x01, 0x81, 0x29, 0x01,
+    0x81, 0x40, 0x01, 0x34, 0x10, 0x81, 0x53, 0x01, 0x81, 0x4A, 0x01, 0x86, 0x55, 0x01, 0x83, 0x52,
+    0x01, 0x34, 0x10, 0x81, 0x61, 0x01, 0x3B, 0x10, 0x82, 0x5C, 0x01, 0x84, 0x61, 0x01, 0x81, 0x4A,
+    0x01, 0x34, 0x10, 0x3B, 0x08, 0x39, 0x20, 0x3B, 0x20, 0x3C, 0x20, 0x3E, 0x20, 0x40, 0x10, 0x39,
+    0x10, 0x3C, 0x10, 0x39, 0x10, 0x3E, 0x10, 0x39, 0x10, 0x81, 0x0C, 0x00, 0x81, 0x07, 0x00, 0x3B,
+    0x10, 0x39, 0x10, 0x43, 0x10, 0x39, 0x10, 0x40, 0x10, 0x35, 0x10, 0x40, 0x04, 0x00, 0x04, 0x32,
+    0x08, 0x00, 0x08, 0x2F, 0xF0, 0x30, 0xF0, 0x32, 0x10, 0x40, 0x10, 0x2D, 0x10, 0x30, 0x10, 0x2D,
+    0x10, 0x32, 0x10, 0x2D, 0x10, 0x81, 0x0C, 0x00, 0x3E, 0x10, 0x2B, 0x10, 0x2F, 0x10, 0x2B, 0x10,
+    0x37, 0x10, 0x2B, 0x10, 0x40, 0x10, 0x29, 0x10, 0x40, 0x10, 0x00, 0x08, 0x2A, 0x10, 0x2B, 0x10,
+    0x2E, 0x08, 0x00, 0x08, 0x30, 0x08, 0x00, 0x08, 0x35, 0x10, 0x2E, 0x10, 0x31, 0x10, 0x2E, 0x10,
+    0x33, 0x10, 0x2E, 0x10, 0x81, 0x0C, 0x00, 0x33, 0x10, 0x2C, 0x10, 0x30, 0x10, 0x2C, 0x10, 0x38,
+    0x10, 0x2C, 0x10, 0x35, 0x10, 0x36, 0x10, 0x34, 0x04, 0x00, 0x04, 0x33, 0x08, 0x00, 0x08, 0x30,
+    0xF0, 0x31, 0xF0, 0x33, 0x10, 0x85, 0x2D, 0x00, 0x81, 0x30, 0x00, 0x87, 0x24, 0x00, 0x35, 0x04,
+    0x81, 0x3A, 0x00, 0x36, 0x10, 0x38, 0x10, 0x33, 0x10, 0x36, 0x10, 0x27, 0x10, 0x81, 0x2A, 0x00,
+    0x81, 0xA1, 0x00, 0x3A, 0x10, 0x35, 0x10, 0x41, 0x10, 0x35, 0x10, 0x3F, 0x10, 0x35, 0x10, 0x3D,
+    0x10, 0x35, 0x10, 0x3C, 0x10, 0x83, 0x08, 0x00, 0x35, 0x10, 0x81, 0x17, 0x00, 0x3C, 0x10, 0x82,
+    0x12, 0x00, 0x84, 0x17, 0x00, 0x35, 0x10, 0x38, 0x10, 0x81, 0x18, 0x00, 0x35, 0x10, 0x81, 0x2B,
+    0x00, 0x88, 0x2E, 0x00, 0x83, 0x27, 0x00, 0x35, 0x10, 0x81, 0x36, 0x00, 0x3C, 0x10, 0x82, 0x31,
+    0x00, 0x84, 0x36, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x36, 0x00, 0x35, 0x10, 0x81, 0x49, 0x00, 0x88,
+    0x4C, 0x00, 0x83, 0x45, 0x00, 0x35, 0x10, 0x81, 0x54, 0x00, 0x3C, 0x10, 0x82, 0x4F, 0x00, 0x84,
+    0x54, 0x00, 0x81, 0x3D, 0x00, 0x81, 0x54, 0x00, 0x35, 0x10, 0x81, 0x67, 0x00, 0x88, 0x6A, 0x00,
+    0x83, 0x63, 0x00, 0x35, 0x10, 0x81, 0x72, 0x00, 0x3C, 0x10, 0x82, 0x6D, 0x00, 0x84, 0x72, 0x00,
+    0x81, 0x5B, 0x00, 0x81, 0x72, 0x00, 0x35, 0x10, 0x81, 0x85, 0x00, 0x3F, 0x08, 0x44, 0x10, 0x41,
+    0x08, 0x00, 0x10, 0x81, 0xB5, 0x02, 0x3F, 0x08, 0x3D, 0x08, 0x3F, 0xF8, 0x44, 0xF8, 0x41, 0xFC,
+    0x81, 0x0A, 0x00, 0x83, 0x18, 0x00, 0x81, 0xC8, 0x02, 0x81, 0x13, 0x00, 0x42, 0xF8, 0x43, 0xF8,
+    0x41, 0xF8, 0x00, 0x10, 0x42, 0x08, 0x00, 0x10, 0x00, 0x10, 0x83, 0x2F, 0x00, 0x81, 0xDF, 0x02,
+    0x84, 0x2A, 0x00, 0x81, 0x2D, 0x00, 0x83, 0x3B, 0x00, 0x81, 0xEB, 0x02, 0x33, 0x08, 0x35, 0x08,
+    0x36, 0xF8, 0x37, 0xF8, 0x35, 0x08, 0x39, 0x08, 0x3A, 0x08, 0x3C, 0x08, 0x3C, 0xF8, 0x3A, 0xF8,
+    0x81, 0x04, 0x00, 0x81, 0x07, 0x00, 0x49, 0x08, 0x3C, 0x08, 0x3A, 0x08, 0x38, 0x08, 0x3C, 0xF8,
+    0x46, 0xF8, 0x35, 0x08, 0x82, 0x06, 0x00, 0x82, 0x09, 0x00, 0x3D, 0x08, 0x3F, 0x08, 0x3C, 0x08,
+    0x3D, 0x08, 0x3A, 0x08, 0x00, 0x08, 0x00, 0x10,
+};
+static const Song bloodytears_packed_song = {"Bloodytears", nullptr, 677, 144, bloodytears_packed};
+
+// Gameofthrones: 130 notes, 1040 -> 179 bytes
+static const uint8_t gameofthrones_packed[] = {
+    0x2D, 0x08, 0x26, 0x08, 0x29, 0x10, 0x2B, 0x10, 0x83, 0x08, 0x00, 0x83, 0x0B, 0x00, 0x83, 0x0E,
+    0x00, 0x81, 0x11, 0x00, 0x2A, 0x10, 0x2B, 0x10, 0x81, 0x18, 0x00, 0x81, 0x07, 0x00, 0x81, 0x1E,
+    0x00, 0x81, 0x0D, 0x00, 0x81, 0x24, 0x00, 0x81, 0x13, 0x00, 0x2D, 0xFC, 0x26, 0xFC, 0x81, 0x2A,
+    0x00, 0x2D, 0x04, 0x26, 0x04, 0x81, 0x31, 0x00, 0x28, 0xFF, 0x2B, 0xFC, 0x24, 0xFC, 0x29, 0x10,
+    0x28, 0x10, 0x2B, 0x04, 0x82, 0x08, 0x00, 0x26, 0xFF, 0x81, 0x1F, 0x00, 0x81, 0x48, 0x00, 0x81,
+    0x1E, 0x00, 0x81, 0x4E, 0x00, 0x85, 0x1D, 0x00, 0x82, 0x1C, 0x00, 0x26, 0xFF, 0x81, 0x33, 0x00,
+    0x81, 0x5C, 0x00, 0x81, 0x32, 0x00, 0x81, 0x62, 0x00, 0x28, 0xFE, 0x81, 0x31, 0x00, 0x28, 0xF8,
+    0x29, 0xF8, 0x28, 0xF8, 0x24, 0xF8, 0x26, 0xFF, 0x32, 0xFE, 0x30, 0xFE, 0x26, 0xFE, 0x2D, 0xFE,
+    0x29, 0xFE, 0x29, 0xFC, 0x2B, 0xFC, 0x2D, 0xFF, 0x85, 0x10, 0x00, 0x28, 0xFC, 0x32, 0x08, 0x2D,
+    0x08, 0x2E, 0x10, 0x30, 0x10, 0x83, 0x08, 0x00, 0x83, 0x0B, 0x00, 0x83, 0x0E, 0x00, 0x00, 0x04,
+    0x3A, 0x10, 0x3C, 0x10, 0x3E, 0x08, 0x39, 0x08, 0x82, 0x08, 0x00, 0x39, 0x10, 0x83, 0x0D, 0x00,
+    0x81, 0x10, 0x00,
+};
+static const Song gameofthrones_packed_song = {"Gameofthrones", nullptr, 130, 85, gameofthrones_packed};
+
+// Merrychristmas: 195 notes, 1560 -> 175 bytes
+static const uint8_t merrychristmas_packed[] = {
+    0x32, 0x04, 0x37, 0x04, 0x37, 0x08, 0x39, 0x08, 0x37, 0x08, 0x36, 0x08, 0x34, 0x04, 0x34, 0x04,
+    0x34, 0x04, 0x39, 0x04, 0x39, 0x08, 0x3B, 0x08, 0x81, 0x12, 0x00, 0x36, 0x04, 0x32, 0x04, 0x32,
+    0x04, 0x3B, 0x04, 0x3B, 0x08, 0x3C, 0x08, 0x3B, 0x08, 0x39, 0x08, 0x37, 0x04, 0x34, 0x04, 0x32,
+    0x08, 0x32, 0x08, 0x81, 0x23, 0x00, 0x36, 0x04, 0x37, 0x02, 0x8B, 0x3A, 0x00, 0x81, 0x37, 0x00,
+    0x8B, 0x25, 0x00, 0x81, 0x33, 0x00, 0x81, 0x10, 0x00, 0x81, 0x49, 0x00, 0x37, 0x04, 0x37, 0x04,
+    0x36, 0x02, 0x36, 0x04, 0x37, 0x04, 0x36, 0x04, 0x34, 0x04, 0x32, 0x02, 0x3B, 0x04, 0x3C, 0x04,
+    0x3B, 0x04, 0x39, 0x04, 0x3E, 0x04, 0x32, 0x04, 0x81, 0x39, 0x00, 0x81, 0x5B, 0x00, 0x81, 0x38,
+    0x00, 0x8B, 0x71, 0x00, 0x81, 0x6E, 0x00, 0x8B, 0x5C, 0x00, 0x81, 0x6A, 0x00, 0x81, 0x47, 0x00,
+    0x81, 0x80, 0x00, 0x8D, 0x37, 0x00, 0x81, 0x57, 0x00, 0x81, 0x79, 0x00, 0x81, 0x56, 0x00, 0x8B,
+    0x8F, 0x00, 0x81, 0x8C, 0x00, 0x8B, 0x7A, 0x00, 0x81, 0x88, 0x00, 0x81, 0x65, 0x00, 0x8B, 0x9E,
+    0x00, 0x81, 0x9B, 0x00, 0x8B, 0x89, 0x00, 0x81, 0x97, 0x00, 0x81, 0x74, 0x00, 0x00, 0x04,
+};
+static const Song merrychristmas_packed_song = {"Merrychristmas", nullptr, 195, 140, merrychristmas_packed};
+
+// Starwars: 88 notes, 704 -> 122 bytes
+static const uint8_t starwars_packed[] = {
+    0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x37, 0x02, 0x3E, 0x02, 0x3C, 0x08, 0x3B, 0x08, 0x39, 0x08,
+    0x43, 0x02, 0x3E, 0x04, 0x84, 0x0A, 0x00, 0x81, 0x0D, 0x00, 0x3C, 0x08, 0x39, 0x02, 0x32, 0x08,
+    0x32, 0x08, 0x32, 0x08, 0x86, 0x1E, 0x00, 0x84, 0x1D, 0x00, 0x81, 0x20, 0x00, 0x81, 0x13, 0x00,
+    0x32, 0xF8, 0x32, 0x10, 0x34, 0xFC, 0x34, 0x08, 0x82, 0x2E, 0x00, 0x37, 0x08, 0x37, 0x08, 0x39,
+    0x08, 0x3B, 0x08, 0x39, 0x04, 0x34, 0x08, 0x36, 0x04, 0x83, 0x19, 0x00, 0x82, 0x42, 0x00, 0x37,
+    0x08, 0x3E, 0xF8, 0x39, 0x10, 0x39, 0x02, 0x00, 0x08, 0x32, 0x08, 0x81, 0x27, 0x00, 0x82, 0x54,
+    0x00, 0x86, 0x26, 0x00, 0x3E, 0xF8, 0x3E, 0x10, 0x43, 0x04, 0x41, 0x08, 0x3F, 0x04, 0x3E, 0x08,
+    0x3C, 0x04, 0x3A, 0x08, 0x39, 0x04, 0x37, 0x08, 0x3E, 0x01,
+};
+static const Song starwars_packed_song = {"Starwars", nullptr, 88, 108, starwars_packed};
+
+// Nevergonnagiveyouup: 340 notes, 2720 -> 478 bytes
+static const uint8_t nevergonnagiveyouup_packed[] = {
+    0x34, 0xFC, 0x36, 0xFC, 0x2F, 0x04, 0x36, 0xFC, 0x38, 0xFC, 0x3B, 0x10, 0x39, 0x10, 0x38, 0x08,
+    0x81, 0x10, 0x00, 0x2F, 0x02, 0x2F, 0x10, 0x2F, 0x10, 0x31, 0x10, 0x34, 0x08, 0x34, 0x10, 0x87,
+    0x1F, 0x00, 0x81, 0x22, 0x00, 0x85, 0x12, 0x00, 0x00, 0x04, 0x31, 0x08, 0x33, 0x08, 0x34, 0x08,
+    0x34, 0x08, 0x36, 0x08, 0x33, 0xF8, 0x31, 0x10, 0x2F, 0x02, 0x00, 0x04, 0x00, 0x08, 0x31, 0x08,
+    0x82, 0x16, 0x00, 0x31, 0x04, 0x2F, 0x08, 0x3B, 0x08, 0x00, 0x08, 0x3B, 0x08, 0x36, 0xFC, 0x81,
+    0x27, 0x00, 0x82, 0x28, 0x00, 0x31, 0x08, 0x81, 0x27, 0x00, 0x00, 0x08, 0x00, 0x08, 0x33, 0x08,
+    0x31, 0x08, 0x2F, 0xFC, 0x82, 0x2A, 0x00, 0x82, 0x3D, 0x00, 0x31, 0x08, 0x2F, 0x04, 0x36, 0x08,
+    0x36, 0x08, 0x36, 0x08, 0x38, 0x08, 0x36, 0x04, 0x00, 0x04, 0x34, 0x02, 0x81, 0x0A, 0x00, 0x81,
+    0x4F, 0x00, 0x83, 0x12, 0x00, 0x2F, 0x04, 0x00, 0x02, 0x82, 0x5F, 0x00, 0x31, 0x08, 0x00, 0x08,
+    0x81, 0x1E, 0x00, 0x36, 0xFC, 0x81, 0x7E, 0x00, 0x34, 0x10, 0x31, 0x10, 0x38, 0xF8, 0x38, 0xF8,
+    0x36, 0xFC, 0x81, 0x8B, 0x00, 0x81, 0x0D, 0x00, 0x36, 0xF8, 0x36, 0xF8, 0x34, 0xF8, 0x33, 0x10,
+    0x31, 0xF8, 0x81, 0x9B, 0x00, 0x81, 0x1D, 0x00, 0x34, 0x04, 0x82, 0x88, 0x00, 0x2F, 0x08, 0x2F,
+    0x08, 0x2F, 0x08, 0x36, 0x04, 0x34, 0x02, 0x81, 0xB0, 0x00, 0x84, 0x32, 0x00, 0x81, 0xB6, 0x00,
+    0x81, 0x38, 0x00, 0x3B, 0x04, 0x33, 0x08, 0x81, 0x2B, 0x00, 0x31, 0x08, 0x81, 0xC5, 0x00, 0x81,
+    0x47, 0x00, 0x34, 0x04, 0x82, 0xB2, 0x00, 0x2F, 0x04, 0x82, 0x28, 0x00, 0x82, 0xB2, 0x00, 0x34,
+    0x08, 0x31, 0x08, 0x34, 0x08, 0x36, 0x04, 0x84, 0x9D, 0x00, 0x82, 0xC0, 0x00, 0x82, 0xD3, 0x00,
+    0x81, 0x96, 0x00, 0x81, 0xBA, 0x00, 0x3B, 0x08, 0x81, 0x96, 0x00, 0x36, 0x08, 0x34, 0x08, 0x00,
+    0x08, 0x2F, 0x08, 0x82, 0xE9, 0x00, 0x81, 0x8A, 0x00, 0x82, 0xBB, 0x00, 0x81, 0xF4, 0x00, 0x82,
+    0xF5, 0x00, 0x81, 0xB8, 0x00, 0x81, 0xCB, 0x00, 0x81, 0xBA, 0x00, 0x38, 0x04, 0x36, 0xFC, 0x34,
+    0x02, 0x81, 0x01, 0x01, 0x81, 0xC0, 0x00, 0x82, 0xC7, 0x00, 0x36, 0x08, 0x2F, 0x08, 0x2F, 0x04,
+    0x00, 0xFC, 0x2F, 0x08, 0x82, 0x1A, 0x01, 0x81, 0xBB, 0x00, 0x81, 0xD8, 0x00, 0x36, 0xFC, 0x81,
+    0x38, 0x01, 0x84, 0xBA, 0x00, 0x81, 0x3E, 0x01, 0x81, 0xC0, 0x00, 0x83, 0xB3, 0x00, 0x31, 0x08,
+    0x81, 0x49, 0x01, 0x81, 0xCB, 0x00, 0x34, 0x04, 0x82, 0x36, 0x01, 0x2F, 0x04, 0x82, 0xAC, 0x00,
+    0x81, 0x59, 0x01, 0x84, 0xDB, 0x00, 0x81, 0x5F, 0x01, 0x81, 0xE1, 0x00, 0x81, 0xA9, 0x00, 0x81,
+    0xD3, 0x00, 0x31, 0x08, 0x81, 0x6D, 0x01, 0x81, 0xEF, 0x00, 0x34, 0x04, 0x82, 0x5A, 0x01, 0x2F,
+    0x04, 0x82, 0xD0, 0x00, 0x81, 0x7D, 0x01, 0x84, 0xFF, 0x00, 0x81, 0x83, 0x01, 0x81, 0x05, 0x01,
+    0x81, 0xCD, 0x00, 0x81, 0xF7, 0x00, 0x31, 0x08, 0x81, 0x91, 0x01, 0x81, 0x13, 0x01, 0x34, 0x04,
+    0x82, 0x7E, 0x01, 0x2F, 0x04, 0x82, 0xF4, 0x00, 0x81, 0xA1, 0x01, 0x84, 0x23, 0x01, 0x81, 0xA7,
+    0x01, 0x81, 0x29, 0x01, 0x81, 0xF1, 0x00, 0x81, 0x1B, 0x01, 0x31, 0x08, 0x81, 0xB5, 0x01, 0x81,
+    0x37, 0x01, 0x34, 0x04, 0x82, 0xA2, 0x01, 0x2F, 0x04, 0x82, 0x18, 0x01, 0x00, 0x04,
+};
+static const Song nevergonnagiveyouup_packed_song = {"Nevergonnagiveyouup", nullptr, 340, 114, nevergonnagiveyouup_packed};
+
+// Thelionsleepstonight: 301 notes, 2408 -> 321 bytes
+static const uint8_t thelionsleepstonight_packed[] = {
+    0x2B, 0x04, 0x2D, 0x04, 0x2F, 0x08, 0x81, 0x04, 0x00, 0x30, 0x04, 0x2F, 0x04, 0x2D, 0x08, 0x2B,
+    0x04, 0x2D, 0x08, 0x2F, 0x04, 0x26, 0x08, 0x26, 0x04, 0x81, 0x04, 0x00, 0x26, 0x01, 0x82, 0x1E,
+    0x00, 0x81, 0x1F, 0x00, 0x87, 0x1B, 0x00, 0x81, 0x12, 0x00, 0x26, 0xFE, 0x00, 0xF8, 0x2F, 0x10,
+    0x2F, 0xF8, 0x81, 0x04, 0x00, 0x81, 0x07, 0x00, 0x81, 0x0A, 0x00, 0x2F, 0x10, 0x30, 0xF8, 0x30,
+    0x10, 0x81, 0x04, 0x00, 0x81, 0x07, 0x00, 0x81, 0x0A, 0x00, 0x2F, 0xF8, 0x81, 0x1E, 0x00, 0x81,
+    0x21, 0x00, 0x81, 0x24, 0x00, 0x2F, 0x10, 0x2D, 0xF8, 0x2D, 0x10, 0x81, 0x04, 0x00, 0x81, 0x07,
+    0x00, 0x81, 0x0A, 0x00, 0x2F, 0xF8, 0x81, 0x38, 0x00, 0x81, 0x3B, 0x00, 0x81, 0x3E, 0x00, 0x82,
+    0x34, 0x00, 0x81, 0x35, 0x00, 0x81, 0x38, 0x00, 0x81, 0x3B, 0x00, 0x2F, 0xF8, 0x81, 0x4F, 0x00,
+    0x81, 0x52, 0x00, 0x81, 0x55, 0x00, 0x82, 0x31, 0x00, 0x81, 0x32, 0x00, 0x81, 0x35, 0x00, 0x81,
+    0x38, 0x00, 0x82, 0x92, 0x00, 0x81, 0x93, 0x00, 0x85, 0x8F, 0x00, 0x2D, 0x04, 0x2B, 0x04, 0x2F,
+    0x04, 0x2D, 0x01, 0x32, 0x04, 0x81, 0x9A, 0x00, 0x2F, 0x04, 0x32, 0x08, 0x85, 0xA3, 0x00, 0x83,
+    0x14, 0x00, 0x32, 0x01, 0x32, 0x04, 0x30, 0x08, 0x32, 0x08, 0x30, 0x02, 0x82, 0xA9, 0x00, 0x81,
+    0xAA, 0x00, 0x26, 0x01, 0x00, 0x04, 0x2F, 0x08, 0x2D, 0x08, 0x2B, 0x08, 0x2A, 0x08, 0x28, 0x08,
+    0x26, 0x08, 0x28, 0x01, 0x87, 0x10, 0x00, 0x82, 0xD7, 0x00, 0x81, 0xD8, 0x00, 0x85, 0xD4, 0x00,
+    0x84, 0x45, 0x00, 0x81, 0xD8, 0x00, 0x81, 0x3E, 0x00, 0x85, 0xE0, 0x00, 0x83, 0x51, 0x00, 0x84,
+    0x3D, 0x00, 0x82, 0xDF, 0x00, 0x81, 0xE0, 0x00, 0x88, 0x36, 0x00, 0x87, 0x37, 0x00, 0x82, 0xFE,
+    0x00, 0x81, 0xFF, 0x00, 0x87, 0xFB, 0x00, 0x81, 0xF2, 0x00, 0x26, 0x01, 0x82, 0x0C, 0x01, 0x81,
+    0x0D, 0x01, 0x85, 0x09, 0x01, 0x84, 0x7A, 0x00, 0x81, 0x0D, 0x01, 0x81, 0x73, 0x00, 0x85, 0x15,
+    0x01, 0x83, 0x86, 0x00, 0x84, 0x72, 0x00, 0x82, 0x14, 0x01, 0x81, 0x15, 0x01, 0x88, 0x6B, 0x00,
+    0x87, 0x6C, 0x00, 0x82, 0x33, 0x01, 0x81, 0x34, 0x01, 0x87, 0x30, 0x01, 0x81, 0x27, 0x01, 0x26,
+    0x01,
+};
+static const Song thelionsleepstonight_packed_song = {"Thelionsleepstonight", nullptr, 301, 122, thelionsleepstonight_packed};
+
+const Song* all_songs[] = {
+    &miichannel_packed_song,
+    &songofstorms_packed_song,
+    &nokia_packed_song,
+    &keyboardcat_packed_song,
+    &minuetg_packed_song,
+    &furelise_packed_song,
+    &greenhill_packed_song,
+    &professorlayton_packed_song,
+    &asabranca_packed_song,
+    &doom_packed_song,
+    &odetojoy_packed_song,
+    &supermariobros_packed_song,
+    &greensleeves_packed_song,
+    &cannonind_packed_song,
+    &pacman_packed_song,
+    &pulodagaita_packed_song,
+    &tetris_packed_song,
+    &zeldatheme_packed_song,
+    &thebadinerie_packed_song,
+    &silentnight_packed_song,
+    &thelick_packed_song,
+    &startrekintro_packed_song,
+    &thegodfather_packed_song,
+    &pinkpanther_packed_song,
+    &takeonme_packed_song,
+    &cantinaband_packed_song,
+    &babyelephantwalk_packed_song,
+    &vampirekiller_packed_song,
+    &princeigor_packed_song,
+    &brahmslullaby_packed_song,
+    &zeldaslullaby_packed_song,
+    &imperialmarch_packed_song,
+    &harrypotter_packed_song,
+    &jigglypuffsong_packed_song,
+    &happybirthday_packed_song,
+    &bloodytears_packed_song,
+    &gameofthrones_packed_song,
+    &merrychristmas_packed_song,
+    &starwars_packed_song,
+    &nevergonnagiveyouup_packed_song,
+    &thelionsleepstonight_packed_song,
+};
+
+const unsigned int song_count = sizeof(all_songs) / sizeof(all_songs[0]);
+#endif
@@ -0,0 +1,78 @@
+#include "song_packed.h"
+
+const uint16_t song_pitch_table[] = {SONG_PITCHES};
+
+void songCursorBegin(SongCursor& cursor, const Song& song, unsigned int startNote) {
+    cursor.song = &song;
+    cursor.note = 0;
+    cursor.position = 0;
+    cursor.refPosition = 0;
+    cursor.refRemaining = 0;
+
+    int frequency, divider;
+    while (cursor.note < startNote && songCursorNext(cursor, frequency, divider)) {
+    }
+}
+
+bool songCursorNext(SongCursor& cursor, int& frequency, int& divider) {
+    const Song& song = *cursor.song;
+    if (cursor.note >= song.length)
+        return false;
+
+    if (song.packed == nullptr) {
+        frequency = song.melody[cursor.note * 2];
+        divider = song.melody[cursor.note * 2 + 1];
+        cursor.note++;
+        return true;
+    }
+
+    const uint8_t* token = song.packed + cursor.position;
+    if (cursor.refRemaining) {
+        token = song.packed + cursor.refPosition;
+        cursor.refRemaining--;
+        cursor.refPosition += 2;
+    } else if (token[0] & SONG_PACKED_REFERENCE) {
+        cursor.refRemaining = token[0] & ~SONG_PACKED_REFERENCE;
+        cursor.refPosition = cursor.position - (token[1] | (token[2] << 8));
+        cursor.position += 3;
+        token = song.packed + cursor.refPosition;
+        cursor.refPosition += 2;
+    } else {
+        cursor.position += 2;
+    }
+
+    frequency = song_pitch_table[token[0]];
+    divider = (int8_t)token[1];
+    cursor.note++;
+    return true;
+}
+
+// The row entry as written, SONG_TIE included
+static int songTrackEntry(const SongTracks& tracks, unsigned int note, uint8_t voice) {
+    unsigned int at = note * tracks.voices + voice;
+    if (tracks.packedRows == nullptr)
+        return tracks.rows[at];
+    uint8_t code = tracks.packedRows[at];
+    return code == SONG_PACKED_TIE ? SONG_TIE : song_pitch_table[code];
+}
+
+uint16_t songTrackPitch(const Song& song, unsigned int note, uint8_t voice) {
+    const SongTracks* tracks = song.tracks;
+    if (tracks == nullptr || voice >= tracks->voices || note >= song.length)
+        return 0;
+    for (;;) {
+        int entry = songTrackEntry(*tracks, note, voice);
+        if (entry != SONG_TIE)
+            return entry;
+        if (note == 0)
+            return 0;
+        note--;
+    }
+}
+
+bool songTrackTied(const Song& song, unsigned int note, uint8_t voice) {
+    const SongTracks* tracks = song.tracks;
+    if (tracks == nullptr || voice >= tracks->voices || note >= song.length)
+        return false;
+    return songTrackEntry(*tracks, note, voice) == SONG_TIE;
+}
@@ -0,0 +1,66 @@
+// Generated by tools/pack_songs.py from the song sources, do not edit.
+#include "song_toc.h"
+
+const SongInfo song_toc[] = {
+    {94725, 286, 220, 880, 0x3FE0}, // Miichannel
+    {34996, 67, 294, 698, 0x1F80}, // Songofstorms
+    {3299, 13, 277, 659, 0x0FC0}, // Nokia
+    {23625, 60, 196, 392, 0x01E0}, // Keyboardcat
+    {55533, 190, 294, 988, 0x7F80}, // Minuetg
+    {127870, 603, 220, 1319, 0xFFE0}, // Furelise
+    {69802, 175, 294, 880, 0x3F80}, // Greenhill
+    {173350, 418, 196, 1175, 0x7FE0}, // Professorlayton
+    {29250, 92, 330, 698, 0x1F80}, // Asabranca
+    {87065, 680, 82, 494, 0x05FE}, // Doom
+    {30312, 62, 196, 392, 0x01E0}, // Odetojoy
+    {73102, 321, 262, 880, 0x3FC0}, // Supermariobros
+    {73273, 136, 294, 698, 0x1F80}, // Greensleeves
+    {60750, 124, 147, 440, 0x03F8}, // Cannonind
+    {3984, 31, 494, 1568, 0xFC00}, // Pacman
+    {62235, 207, 262, 880, 0x3FC0}, // Pulodagaita
+    {35985, 97, 440, 880, 0x3E00}, // Tetris
+    {60283, 110, 349, 1109, 0x7F00}, // Zeldatheme
+    {41287, 241, 349, 1175, 0x7F00}, // Thebadinerie
+    {28923, 47, 262, 698, 0x1FC0}, // Silentnight
+    {3749, 7, 262, 392, 0x01C0}, // Thelick
+    {4134, 8, 294, 587, 0x0F80}, // Startrekintro
+    {62100, 129, 262, 523, 0x07C0}, // Thegodfather
+    {30881, 88, 294, 659, 0x0F80}, // Pinkpanther
+    {18511, 96, 494, 988, 0x7C00}, // Takeonme
+    {27381, 64, 330, 698, 0x1F80}, // Cantinaband
+    {19634, 68, 262, 659, 0x0FC0}, // Babyelephantwalk
+    {52334, 252, 247, 988, 0x7FC0}, // Vampirekiller
+    {88330, 138, 277, 784, 0x1FC0}, // Princeigor
+    {34805, 54, 311, 622, 0x0F80}, // Brahmslullaby
+    {31496, 48, 220, 587, 0x0DE0}, // Zeldaslullaby
+    {25987, 86, 349, 880, 0x3F00}, // Imperialmarch
+    {38609, 62, 277, 698, 0x1FC0}, // Harrypotter
+    {30488, 38, 587, 880, 0x3800}, // Jigglypuffsong
+    {13883, 25, 262, 523, 0x07C0}, // Happybirthday
+    {95679, 677, 277, 1976, 0xFFC0}, // Bloodytears
+    {86225, 130, 233, 1047, 0x77E0}, // Gameofthrones
+    {65174, 195, 523, 1047, 0x7C00}, // Merrychristmas
+    {36496, 88, 466, 1397, 0xFE00}, // Starwars
+    {103605, 340, 440, 880, 0x3E00}, // Nevergonnagiveyouup
+    {127461, 301, 262, 523, 0x07C0}, // Thelionsleepstonight
+};
+
+const uint16_t song_band_boundaries[SONG_TOC_BANDS + 1] = {
+    31, // NOTE_B0
+    65, // NOTE_C2
+    98, // NOTE_G2
+    131, // NOTE_C3
+    165, // NOTE_E3
+    196, // NOTE_G3
+    247, // NOTE_B3
+    294, // NOTE_D4
+    349, // NOTE_F4
+    415, // NOTE_GS4
+    494, // NOTE_B4
+    587, // NOTE_D5
+    698, // NOTE_F5
+    831, // NOTE_GS5
+    988, // NOTE_B5
+    1319, // NOTE_E6
+    4978, // NOTE_DS8
+};
@@ -1,26 +1,259 @@
 #include "clib/u8g2.h"
 #include "song_list.h"
+#include "song_toc.h"
 #include <Arduino.h>
-#include <LiquidCrystal_I2C.h>
+#include <EEPROM.h>
+#include <ClockScaler.h>
+#include <I2CBus.h>
+#include <InputSampler.h>
+#include <LineInAnalyzer.h>
+#include <LiquidCrystal_PCF8574.h>
+#include <PlaybackTrace.h>
+#include <RamBudget.h>
+#include <ResumeJournal.h>
+#include <SerialUpload.h>
+#include <SongStream.h>
+#include <StaticArena.h>
+#include <Telemetry.h>
+#include <ToneTimer.h>
 #include <U8g2lib.h>
 #include <Wire.h>
 #include "note.h"
-
+#include "player.h"
+
+// Page mode renders the UI one 8-pixel page at a time into a 128-byte
+// buffer instead of keeping the whole 1 KB frame in RAM
+#define OLED_PAGE_MODE 1
+#if OLED_PAGE_MODE
+U8G2_SH1106_128X64_NONAME_1_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
+#else
 U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
-LiquidCrystal_I2C *lcd = nullptr;
-
-#define BUZZER_PIN D3
-#define JOYSTICK_X_PIN A0
-#define JOYSTICK_Y_PIN A1
+#endif
+LiquidCrystal_PCF8574 *lcd = nullptr;
+
+// Objects that exist only if their hardware answers at boot are placed in
+// this arena rather than on the heap. The build fails if the slots outgrow
+// RUNTIME_ARENA_SIZE; the map is part of the RAM report.
+#define RUNTIME_ARENA_SIZE 848
+enum RuntimeArenaSlot { ARENA_LCD };
+const char *const runtimeArenaNames[] = {"lcd"};
+StaticArena<RUNTIME_ARENA_SIZE, LiquidCrystal_PCF8574> runtimeArena;
+
+// Both displays share Wire through the bus scheduler. The OLED gets
+// Fast-mode and a deadline of one UI frame, the LCD registers itself at 100 kHz.
+#define OLED_I2C_ADDRESS 0x3C
+#define OLED_CLOCK_HZ 400000
+#define OLED_PRIORITY 1
+#define OLED_FRAME_DEADLINE_US 20000
+#define I2C_STATS_REPORT_MS 0 // print bus stats to Serial every N ms, 0 = off
+
+// RAM usage by subsystem, printed once playback has started, on a '?' over
+// Serial, and every RAM_REPORT_MS if set
+RamBudget ramBudget;
+bool ramReportPending = true;
+#define RAM_REPORT_MS 0
+
+// Fast boot: probe the LCD address cached in emulated EEPROM instead of
+// scanning, bring both displays up asynchronously and start playing while the
+// splash is still on screen. Boot-to-first-note time is printed to Serial.
+#define FAST_BOOT 1
+#define SPLASH_MS 800
+#define EEPROM_LCD_MAGIC_ADDR 0
+#define EEPROM_LCD_ADDRESS_ADDR 1
+#define EEPROM_LCD_MAGIC 0xA5
+
+I2CBus i2cBus;
+I2CDevice oledDevice(OLED_I2C_ADDRESS, OLED_CLOCK_HZ, OLED_PRIORITY);
+
+// The buzzer on D3 (PB3) is driven by TIM2 (see ToneTimer), a second one on
+// D7 (PA8) by TIM1 plays the bass or harmony of songs with tracks; the timer
+// channels fix those pins. With TONE_VOICES 1, songs with tracks play as
+// arpeggiated chords instead. Print the per-pitch timer table and its
+// rounding errors at boot.
+#define TONE_TABLE_REPORT 0
+ToneTimer buzzer;
+// The joystick is sampled by ADC channel, not by pin
+#define JOYSTICK_X_ADC_CHANNEL 0 // A0, PA0
+#define JOYSTICK_Y_ADC_CHANNEL 1 // A1, PA1
 #define PAUSE_BUTTON_PIN D2
+// Line-in analyzer mode: the visualizer shows the spectrum of the analog
+// input on A2 instead of the notes being played (see LineInAnalyzer)
+#define LINE_IN_ANALYZER 0
+#define LINE_IN_ADC_CHANNEL 4 // A2, PA4
+#if LINE_IN_ANALYZER
+LineInAnalyzer lineIn;
+#endif
 #define REST 0
-#define NUM_BANDS 16
-#define BAR_PIXEL_TOP_Y 2
+#define NUM_BANDS SONG_TOC_BANDS
+#define BAR_PIXEL_TOP_Y 13 // below the title
 #define BAR_PIXEL_BOT_Y 34
 
 const Song *const *songs = all_songs;
 extern const unsigned int song_count;
 
+// Song, note and speed survive power cycles. Flash erases stall the CPU for
+// tens of ms, so they only happen while paused, between songs or during rests
+// at least this long.
+ResumeJournal resumeJournal;
+#define RESUME_ERASE_MIN_REST_MS 60
+
+// Optional SPI NOR flash with more songs (see tools/songbank.cpp). They are
+// appended to the catalog after the built-in ones.
+#define SONG_FLASH_CS_PIN D10
+SpiNorStorage songFlash(SONG_FLASH_CS_PIN);
+SongBank songBank;
+SongStream songStream;
+
+// A song uploaded over serial (see tools/upload_song.py) is the last catalog
+// entry and plays right after the current one
+#define SERIAL_BAUD 921600
+SerialUpload serialUpload;
+RamStorage uploadStorage;
+SongBank uploadBank;
+bool uploadQueued = false;
+
+// Binary telemetry on D8 (USART1 TX), decoded by tools/telemetry.py. Note
+// onsets carry the time the note was due: when the previous note should have
+// ended, reset at the start of a song and after a pause.
+#define TELEMETRY 1
+Telemetry telemetry;
+NotePlayer player;
+
+void onI2CTransfer(uint8_t address, uint16_t bytes, uint32_t waitUs, uint32_t transferUs) {
+  telemetry.i2c(address, bytes, waitUs, transferUs);
+}
+
+// Trace mode: every note start and stop goes into a RAM ring, printed to
+// Serial after each song for tools/tracecmp.py. Stops are when the buzzer's
+// stop timer ends the note. Costs 3 KB of RAM, so it is off by default.
+#define TRACE 0
+#if TRACE
+PlaybackTrace trace;
+
+void writeTraceLine(const char *line) {
+  Serial.println(line);
+}
+#endif
+
+void traceSong(int songIndex, uint16_t speedPermille) {
+#if TRACE
+  trace.song(micros(), songIndex, speedPermille);
+#endif
+}
+
+void traceNote(uint32_t onsetUs, unsigned int noteIdx, int frequency, uint32_t stopUs) {
+#if TRACE
+  trace.start(onsetUs, noteIdx, frequency);
+  trace.stop(stopUs, noteIdx);
+#endif
+}
+
+// A tempo change moved the end of the sounding note; the later stop wins
+void traceRetime(unsigned int noteIdx, uint32_t stopUs) {
+#if TRACE
+  trace.stop(stopUs, noteIdx);
+#endif
+}
+
+// The ideal schedule restarts at the next note, after a pause or speed change
+void traceAnchor(unsigned int noteIdx, uint16_t speedPermille) {
+#if TRACE
+  trace.anchor(micros(), noteIdx, speedPermille);
+#endif
+}
+
+void traceDump() {
+#if TRACE
+  trace.dump(writeTraceLine);
+#endif
+}
+
+unsigned int catalogSize() {
+  return song_count + songBank.count() + uploadBank.count();
+}
+
+unsigned int uploadedSongIndex() {
+  return song_count + songBank.count();
+}
+
+int mod(int a, int b) {
+  return (a % b + b) % b;
+}
+
+// The next song is prepared while the current one plays its last
+// SONG_PREFETCH_MS (see player.h)
+
+struct SongPlan {
+  int index = -1; // -1 = not prepared
+  const Song *song; // nullptr for streamed songs
+  const SongBank *bank;
+  uint16_t bankIndex;
+  unsigned int length;
+  unsigned int tempo;
+  uint32_t durationMs;
+  uint16_t bandMask;
+  const char *name;
+  char streamedName[SONG_BANK_NAME_SIZE];
+  SongCursor cursor;
+};
+
+// One plays while the other is prepared
+SongPlan songPlans[2];
+SongPlan *nextPlan = &songPlans[0];
+
+bool prepareSong(SongPlan &plan, int songIndex) {
+  plan.index = -1;
+  if (songIndex >= (int)song_count) {
+    // Catalog entries past the built-in songs are streamed from a bank
+    bool uploaded = songIndex >= (int)uploadedSongIndex();
+    SongBankEntry entry;
+    plan.song = nullptr;
+    plan.bank = uploaded ? &uploadBank : &songBank;
+    plan.bankIndex = songIndex - (uploaded ? uploadedSongIndex() : song_count);
+    if (!plan.bank->entry(plan.bankIndex, entry))
+      return false;
+    plan.length = entry.length;
+    plan.tempo = entry.tempo;
+    plan.durationMs = entry.durationMs;
+    plan.bandMask = 0;
+    memcpy(plan.streamedName, entry.name, sizeof(plan.streamedName));
+    plan.name = plan.streamedName;
+  } else {
+    plan.song = all_songs[songIndex];
+    plan.length = plan.song->length;
+    plan.tempo = plan.song->tempo;
+    plan.durationMs = song_toc[songIndex].durationMs;
+    plan.bandMask = song_toc[songIndex].bandMask;
+    plan.name = plan.song->name;
+    songCursorBegin(plan.cursor, *plan.song);
+  }
+  plan.index = songIndex;
+  return true;
+}
+
+// What plays after songIndex ends on its own
+int followingSong(int songIndex) {
+  return uploadQueued ? uploadedSongIndex() : mod(songIndex + 1, catalogSize());
+}
+
+void serviceUpload() {
+  switch (serialUpload.poll()) {
+  case SerialUpload::STARTED:
+    // The buffer is about to be overwritten
+    uploadBank = SongBank();
+    uploadQueued = false;
+    nextPlan->index = -1;
+    break;
+  case SerialUpload::DONE:
+    uploadStorage = RamStorage(serialUpload.image(), serialUpload.imageSize());
+    uploadQueued = uploadBank.begin(uploadStorage) && uploadBank.count() > 0;
+    nextPlan->index = -1;
+    break;
+  default:
+    break;
+  }
+}
+
 // UI
 struct {
   bool isPaused = false;
@@ -30,29 +263,143 @@ struct {
   uint8_t visualBands[NUM_BANDS] = {0};
 
   int currentSongNoteIdx = 0;
-  float *songNoteTimes;
   float songDuration;
+  float songPositionMs = 0;
+  const char *songName = "";
+  uint16_t songBandMask = 0;
 
   uint32_t scrollTimeBegin = 0;
 } uiState;
 
-// Joystick state tracking
-const unsigned long SKIP_INTERVAL = 1500; // 1.5 seconds in milliseconds
-unsigned long lastJoystickXFlick = 0;
-int lastJoystickXDirection = 0; // 0 = neutral, 1 = right, -1 = left
-unsigned long lastJoystickYFlick = 0;
-int lastJoystickYDirection = 0; // 0 = neutral, 1 = up, -1 = down
+// Controls are sampled from a 1 kHz interrupt (see InputSampler). Skip,
+// pause and resume are made audible right there, within a sample period;
+// the loop catches up with playback state and the display when it next
+// polls. Every control's path is timed and sent as a LATENCY telemetry
+// record, in us after the sample that saw it:
+//   audible   the buzzer was stopped, held or released
+//   handled   the loop took the input
+//   note      the first note of the next song, for skips
+InputSampler inputs;
+volatile bool pauseRequested = false;
+bool skipRequested = false;
+
+struct {
+  TelemetryInput input;
+  uint32_t inputUs;
+  uint32_t audibleUs;
+  uint32_t handledUs;
+  volatile bool open;
+} inputLatency;
+
+// The CPU clock follows the loop's load (see ClockScaler): down to 36 or
+// 24 MHz while paused or on a long note with little to draw, back up when
+// the displays get busy or an input arrives. Switches wait until no bus
+// whose clock changes is mid-transfer, and never leave a sounding note off
+// pitch: a note the clock is too slow for holds the I2C bus and waits up to
+// CLOCK_NOTE_WAIT_US for the transfers in flight before it starts. 8 MHz
+// cannot clock Serial and telemetry at their baud rates, so it is only used
+// with slower ones. The line-in analyzer's sample rate comes from the ADC
+// clock, so it pins 72 MHz.
+#define CLOCK_SCALING 1
+#define CLOCK_NOTE_WAIT_US 4000 // about one OLED page at 400 kHz
+#if CLOCK_SCALING && !LINE_IN_ANALYZER
+#define CLOCK_LOWEST_PROFILE clockLowestProfile(SERIAL_BAUD, TELEMETRY ? TELEMETRY_BAUD : 0)
+#else
+#define CLOCK_LOWEST_PROFILE CLOCK_72MHZ
+#endif
+ClockScaler clockScaler;
+
+// Runs with interrupts off. A switch between 72 and 36 MHz keeps APB1,
+// and may run with an I2C transfer in flight (see clockSwitchSafe()).
+void onClockChanged() {
+  static uint32_t pclk1Hz = clockPclk1Hz(clockProfiles[CLOCK_72MHZ]);
+  buzzer.clockChanged();
+  inputs.clockChanged();
+  telemetry.clockChanged();
+  if (HAL_RCC_GetPCLK1Freq() != pclk1Hz) {
+    pclk1Hz = HAL_RCC_GetPCLK1Freq();
+    serialUpload.clockChanged(SERIAL_BAUD);
+    i2cBus.clockChanged();
+  }
+}
+
+// Only the buses whose clock changes need to be between transfers: 72 and
+// 36 MHz share APB1, so between them the I2C bus and Serial may be busy
+bool clockSwitchSafe(uint8_t profile) {
+  const ClockProfile &from = clockProfiles[clockScaler.profile()];
+  const ClockProfile &to = clockProfiles[profile];
+  if (clockPclk1Hz(from) != clockPclk1Hz(to) && (i2cBus.active() != nullptr || !serialUpload.idle()))
+    return false;
+  return from.hz == to.hz || telemetry.idle();
+}
+
+// The tone timers' new settings are worked out first, so the switch only
+// writes registers with interrupts off
+void selectClock(uint8_t profile) {
+  buzzer.prepareClock(clockProfiles[profile].hz);
+  clockScaler.select(profile);
+}
+
+// The profile wanted for the load, or a faster one the sounding notes are
+// exact at
+void serviceClock() {
+  uint8_t profile = clockScaler.wanted();
+  while (profile > CLOCK_72MHZ && !buzzer.exactAt(clockProfiles[profile].hz))
+    profile--;
+  if (profile != clockScaler.profile() && clockSwitchSafe(profile))
+    selectClock(profile);
+}
+
+// Before starting notes: a faster clock if they would be off pitch at this
+// one. Only steps up, serviceClock() steps down. A bus whose clock changes
+// gets up to CLOCK_NOTE_WAIT_US to finish, with nothing new started on the
+// I2C bus meanwhile; only a UART still busy after that leaves the note off
+// pitch until serviceClock() catches up.
+void clockForNotes(const uint16_t *frequencies, uint8_t count) {
+  uint8_t profile = clockScaler.profile();
+  for (uint8_t i = 0; i < count; i++) {
+    while (profile > CLOCK_72MHZ && frequencies[i] != TONE_TIE &&
+           !ToneTimer::exact(clockProfiles[profile].hz, frequencies[i]))
+      profile--;
+  }
+  if (profile == clockScaler.profile())
+    return;
+  i2cBus.hold(true);
+  uint32_t startUs = micros();
+  while (!clockSwitchSafe(profile) && micros() - startUs < CLOCK_NOTE_WAIT_US)
+    i2cBus.service();
+  if (clockSwitchSafe(profile))
+    selectClock(profile);
+  i2cBus.hold(false);
+}
 
-// Button state tracking
-int lastButtonState = HIGH;
-unsigned long lastDebounceTime = 0;
-const unsigned long DEBOUNCE_DELAY = 50; // 50ms debounce delay
-const unsigned long BUTTON_PRESS_COOLDOWN = 200; // 200ms between button presses
+bool oledRenderPages();
+
+// Replaces the loop's delay(): idle time for the load, and the switch. An
+// OLED frame in progress gets its next page as soon as the bus has taken
+// the last one.
+void loopIdle(uint32_t ms) {
+  serviceClock();
+  uint32_t startMs = millis();
+  while (oledRenderPages() && millis() - startMs < ms)
+    clockScaler.idle(1);
+  uint32_t spentMs = millis() - startMs;
+  if (spentMs < ms)
+    clockScaler.idle(ms - spentMs);
+}
 
 // Playback parameters (speedup, volume, pitch)
-const float SPEED_SETTINGS[] = {0.25, 0.5, 1.0, 1.5, 2.0, 3.0};
 const char* SPEED_SETTINGS_STR[] = {"0.25x", "0.5x", "1.0x", "1.5x", "2.0x", "3.0x"};
-const int SPEED_SETTINGS_MAX_IDX = (sizeof(SPEED_SETTINGS) / sizeof(SPEED_SETTINGS[0]) - 1);
+static_assert(sizeof(SPEED_SETTINGS_STR) / sizeof(SPEED_SETTINGS_STR[0]) == SPEED_SETTINGS_MAX_IDX + 1,
+              "one label per speed setting");
+
+unsigned long splashUntil = 0;
+unsigned long bootFirstNoteMs = 0;
+
+bool probeI2C(uint8_t address) {
+  Wire.beginTransmission(address);
+  return Wire.endTransmission() == 0;
+}
 
 // Scan I2C bus for LCD address (address-independent)
 uint8_t scanI2CForLCD() {
@@ -62,14 +409,37 @@ uint8_t scanI2CForLCD() {
   uint8_t numAddresses = sizeof(addresses) / sizeof(addresses[0]);
 
   for (uint8_t i = 0; i < numAddresses; i++) {
-    Wire.beginTransmission(addresses[i]);
-    if (Wire.endTransmission() == 0) {
+    if (probeI2C(addresses[i])) {
       return addresses[i];
     }
   }
   return 0; // Not found
 }
 
+// One probe on the address found last boot, full scan only if it moved
+uint8_t findLCDCached() {
+  uint8_t cached = 0;
+  if (EEPROM.read(EEPROM_LCD_MAGIC_ADDR) == EEPROM_LCD_MAGIC)
+    cached = EEPROM.read(EEPROM_LCD_ADDRESS_ADDR);
+
+  if (cached != 0 && probeI2C(cached))
+    return cached;
+
+  uint8_t found = scanI2CForLCD();
+  if (found != 0) {
+    // Erases a flash page, but only on the first boot with this hardware
+    EEPROM.update(EEPROM_LCD_ADDRESS_ADDR, found);
+    EEPROM.update(EEPROM_LCD_MAGIC_ADDR, EEPROM_LCD_MAGIC);
+  }
+  return found;
+}
+
+void reportBootTime() {
+  // millis() starts counting at reset, so this includes the core's own init
+  bootFirstNoteMs = millis();
+  Serial.printf("boot: first note after %lu ms\n", bootFirstNoteMs);
+}
+
 void toneWithVolume(uint8_t pin, unsigned int frequency, unsigned long duration, uint8_t dutyCycle = 50) {
   tone(pin, frequency, duration);
   return;
@@ -99,31 +469,10 @@ int noteToBar(int note) {
   if (note == 0)
     return -1; // REST
 
-  // Define note boundaries for each bar (divide the musical range evenly)
-  // This covers the full range from NOTE_B0 (31) to NOTE_DS8 (4978)
-  const int boundaries[NUM_BANDS + 1] = {
-      31,   // NOTE_B0
-      65,   // NOTE_C2
-      98,   // NOTE_G2
-      131,  // NOTE_C3
-      165,  // NOTE_E3
-      196,  // NOTE_G3
-      247,  // NOTE_B3
-      294,  // NOTE_D4
-      349,  // NOTE_F4
-      415,  // NOTE_GS4
-      494,  // NOTE_B4
-      587,  // NOTE_D5
-      698,  // NOTE_F5
-      831,  // NOTE_GS5
-      988,  // NOTE_B5
-      1319, // NOTE_E6
-      4978  // NOTE_DS8
-  };
-
-  // Find which bar this note belongs to
+  // Find which bar this note belongs to. The edges come from the generated
+  // song table of contents, so they match its per-song band masks.
   for (int i = 0; i < NUM_BANDS; i++) {
-    if (note >= boundaries[i] && note < boundaries[i + 1]) {
+    if (note >= song_band_boundaries[i] && note < song_band_boundaries[i + 1]) {
       return i;
     }
   }
@@ -134,6 +483,12 @@ int noteToBar(int note) {
 void updateVisualizer(int currentNote) {
   auto& visualBands = uiState.visualBands;
 
+#if LINE_IN_ANALYZER
+  // Bars keep the last spectrum until the next capture is in
+  static_assert(SPECTRUM_BANDS == NUM_BANDS, "the analyzer fills the visualizer's bands");
+  lineIn.update(visualBands);
+#else
+
   // Fast decay for ALL bars (including neighbors)
   for (int i = 0; i < NUM_BANDS; i++) {
     visualBands[i] = constrain(visualBands[i] - 50, 25, 255);
@@ -163,298 +518,927 @@ void updateVisualizer(int currentNote) {
       }
     }
   }
+#endif
 }
 
-void drawUI_oled() {
-  const Song &song = *all_songs[uiState.currentSong];
+// One transaction per page, so LCD bursts can interleave between pages
+// instead of waiting for a whole frame
+void oledSubmitPage(uint8_t page, const uint8_t *data, uint32_t deadline) {
+  I2CTransaction transaction;
+  // Co=1 control bytes for page and column (SH1106 starts at column 2),
+  // then Co=0 D/C=1 for the data stream
+  const uint8_t header[] = {0x80, (uint8_t)(0xB0 | page), 0x80, 0x02, 0x80, 0x10, 0x40};
+  memcpy(transaction.header, header, sizeof(header));
+  transaction.headerLength = sizeof(header);
+  transaction.payload = data;
+  transaction.payloadLength = 128;
+  transaction.deadlineUs = deadline;
+  oledDevice.submit(transaction);
+}
+
+// Draws the rows from top up to (not including) bottom
+typedef void (*OledDraw)(int top, int bottom);
+
+// Renders a frame with draw() and queues it on the bus. A full buffer is
+// drawn once and goes out in the background. In page mode every page reuses
+// the one page buffer, so a page can only be rendered once the bus has
+// copied the previous one out. oledRenderPages() renders as many as that
+// allows and returns, the loop calls it again until the frame is done.
+struct {
+  OledDraw draw;
+  uint8_t nextPage = 8; // 8 when no frame is in progress
+  uint32_t deadline;
+} oledRender;
+
+// True while pages are left to render
+bool oledRenderPages() {
+#if OLED_PAGE_MODE
+  while (oledRender.nextPage < 8) {
+    i2cBus.service();
+    if (oledDevice.waiting())
+      return true;
+    uint8_t page = oledRender.nextPage++;
+    u8g2.setBufferCurrTileRow(page);
+    u8g2.clearBuffer();
+    oledRender.draw(page * 8, page * 8 + 8);
+    oledSubmitPage(page, u8g2.getBufferPtr(), oledRender.deadline);
+  }
+#endif
+  return false;
+}
+
+void oledRenderFrame(OledDraw draw) {
+  oledRender.deadline = micros() + OLED_FRAME_DEADLINE_US;
+#if OLED_PAGE_MODE
+  oledRender.draw = draw;
+  oledRender.nextPage = 0;
+  oledRenderPages();
+#else
   u8g2.clearBuffer();
+  draw(0, 64);
+  for (uint8_t page = 0; page < 8; page++)
+    oledSubmitPage(page, u8g2.getBufferPtr() + page * 128, oledRender.deadline);
+#endif
+}
+
+// Boot only: the whole frame is queued before anything is sent after it
+void oledRenderFrameNow(OledDraw draw) {
+  oledRenderFrame(draw);
+  while (oledRenderPages()) {
+  }
+}
+
+// Whether rows [y0, y1) are inside [top, bottom)
+bool rowsVisible(int top, int bottom, int y0, int y1) {
+  return y0 < bottom && y1 > top;
+}
+
+void drawSplash(int top, int bottom) {
+  u8g2.setFont(u8g2_font_ncenB08_tr);
+  u8g2.drawStr(20, 32, "Music Player");
+}
+
+// A Co=0 D/C=0 command stream, sent after the frames queued before it.
+// False if the queue was full.
+bool oledSubmitCommands(const uint8_t *commands, uint8_t count) {
+  I2CTransaction transaction;
+  transaction.header[0] = 0x00;
+  memcpy(transaction.header + 1, commands, count);
+  transaction.headerLength = count + 1;
+  transaction.deadlineUs = micros() + OLED_FRAME_DEADLINE_US;
+  return oledDevice.submit(transaction);
+}
+
+// Turns the panel on once the frames queued before it have landed
+void oledSubmitDisplayOn() {
+  const uint8_t displayOn = 0xAF;
+  oledSubmitCommands(&displayOn, 1);
+}
+
+// Idle policy for both displays, by time since the last input: the OLED
+// first only gets a frame every DISPLAY_SLOW_FRAME_MS, then it is dimmed,
+// then the SH1106 sleeps and the LCD backlight goes off. The SH1106 keeps
+// its RAM while asleep, so an input brings the last frame back with one
+// command instead of a redraw, and full rate resumes with the next frame.
+// 0 turns a step off.
+#define DISPLAY_SLOW_AFTER_MS 30000
+#define DISPLAY_DIM_AFTER_MS 120000
+#define DISPLAY_OFF_AFTER_MS 600000
+#define DISPLAY_SLOW_FRAME_MS 500
+#define OLED_CONTRAST 0xCF // u8g2's SH1106 setting
+#define OLED_DIM_CONTRAST 0x08
+
+enum DisplayPower { DISPLAY_FULL, DISPLAY_SLOW, DISPLAY_DIM, DISPLAY_OFF };
+
+struct {
+  DisplayPower level = DISPLAY_FULL;
+  volatile uint32_t lastInputMs = 0; // set by the sampler's interrupt
+  uint32_t lastFrameMs = 0;
+  bool lcdDark = false;
+} displayIdle;
+
+void updateDisplayPower() {
+  uint32_t idleMs = millis() - displayIdle.lastInputMs;
+  DisplayPower level = DISPLAY_FULL;
+  if (DISPLAY_OFF_AFTER_MS && idleMs >= DISPLAY_OFF_AFTER_MS)
+    level = DISPLAY_OFF;
+  else if (DISPLAY_DIM_AFTER_MS && idleMs >= DISPLAY_DIM_AFTER_MS)
+    level = DISPLAY_DIM;
+  else if (DISPLAY_SLOW_AFTER_MS && idleMs >= DISPLAY_SLOW_AFTER_MS)
+    level = DISPLAY_SLOW;
+  if (level == displayIdle.level)
+    return;
+
+  uint8_t commands[3];
+  uint8_t count = 0;
+  bool dim = level >= DISPLAY_DIM;
+  if (dim != (displayIdle.level >= DISPLAY_DIM)) {
+    commands[count++] = 0x81;
+    commands[count++] = dim ? OLED_DIM_CONTRAST : OLED_CONTRAST;
+  }
+  bool off = level == DISPLAY_OFF;
+  if (off != (displayIdle.level == DISPLAY_OFF))
+    commands[count++] = off ? 0xAE : 0xAF;
+  // Retried with the next frame if the queue is full
+  if (count && !oledSubmitCommands(commands, count))
+    return;
+  displayIdle.level = level;
+}
+
+// The song title across the top two pages. It is rendered once per song
+// into an off-screen strip in the page layout; a frame copies a 128-column
+// window of it, so scrolling a title too wide for the panel moves it a
+// pixel at a time for the cost of two memcpy()s.
+#define OLED_TITLE_STRIP_WIDTH 224
+#define OLED_TITLE_GAP 32       // blank columns before a scrolling title repeats
+#define OLED_TITLE_BASELINE 8   // descenders reach row 10
+#define OLED_TITLE_HOLD_MS 2000 // before a title starts scrolling
+#define OLED_TITLE_SPEED 30     // pixels per second
+
+struct {
+  uint8_t strip[2][OLED_TITLE_STRIP_WIDTH];
+  uint16_t width; // columns of text, then OLED_TITLE_GAP blank ones
+  const char *name;
+  int song = -1;
+  uint32_t startMs;
+} oledTitle;
+
+// The buffer row of a page while it is being drawn
+uint8_t *oledPageBuffer(uint8_t page) {
+#if OLED_PAGE_MODE
+  return u8g2.getBufferPtr();
+#else
+  return u8g2.getBufferPtr() + page * 128;
+#endif
+}
+
+// Borrows the frame buffer, so only while no frame is on the bus
+void oledRenderTitle() {
+  oledTitle.name = uiState.songName;
+  oledTitle.song = uiState.currentSong;
+  oledTitle.startMs = millis();
+
+  u8g2.setFont(u8g2_font_ncenB08_tr);
+  uint16_t width = u8g2.getStrWidth(oledTitle.name);
+  oledTitle.width = min(width, (uint16_t)(OLED_TITLE_STRIP_WIDTH - OLED_TITLE_GAP));
+
+  // 128 columns at a time, the text shifted left by the columns done
+  for (uint16_t x = 0; x < OLED_TITLE_STRIP_WIDTH; x += 128) {
+    uint16_t columns = min(128, OLED_TITLE_STRIP_WIDTH - x);
+#if OLED_PAGE_MODE
+    for (uint8_t page = 0; page < 2; page++) {
+      u8g2.setBufferCurrTileRow(page);
+      u8g2.clearBuffer();
+      u8g2.drawStr(-(int)x, OLED_TITLE_BASELINE, oledTitle.name);
+      memcpy(oledTitle.strip[page] + x, oledPageBuffer(page), columns);
+    }
+#else
+    u8g2.clearBuffer();
+    u8g2.drawStr(-(int)x, OLED_TITLE_BASELINE, oledTitle.name);
+    for (uint8_t page = 0; page < 2; page++)
+      memcpy(oledTitle.strip[page] + x, oledPageBuffer(page), columns);
+#endif
+  }
+  // A title cut at the strip's end still gets its gap
+  for (uint8_t page = 0; page < 2; page++)
+    memset(oledTitle.strip[page] + oledTitle.width, 0, OLED_TITLE_STRIP_WIDTH - oledTitle.width);
+}
+
+// Centred if it fits, otherwise the window from column scroll, wrapping
+void oledBlitTitle(uint8_t page, uint16_t scroll) {
+  uint8_t *row = oledPageBuffer(page);
+  const uint8_t *strip = oledTitle.strip[page];
+  if (oledTitle.width <= 128) {
+    memcpy(row + (128 - oledTitle.width) / 2, strip, oledTitle.width);
+    return;
+  }
+  uint16_t first = min(128, oledTitle.width + OLED_TITLE_GAP - scroll);
+  memcpy(row, strip + scroll, first);
+  memcpy(row + first, strip, 128 - first);
+}
+
+// Everything the OLED shows, worked out once per frame, so a page pass only
+// draws what touches its rows
+struct {
+  uint16_t titleScroll;
+  bool isPaused;
+  char timeText[32];
+  int progressX;
+  uint8_t barHeight[NUM_BANDS];
+  uint16_t bandMask;
+} oledFrame;
+
+void drawOledFrame(int top, int bottom) {
+  // Title first: the copy overwrites whole page bytes
+  for (uint8_t page = 0; page < 2; page++) {
+    if (rowsVisible(top, bottom, page * 8, page * 8 + 8))
+      oledBlitTitle(page, oledFrame.titleScroll);
+  }
 
   // Draw play status
   int baseY = 40;
-  if (uiState.isPaused) {
-    u8g2.drawBox(0, baseY, 4, 12);
-    u8g2.drawBox(6, baseY, 4, 12);
-  } else {
-    u8g2.drawTriangle(0, baseY, 12, baseY + 6, 0, baseY + 12);
+  if (rowsVisible(top, bottom, baseY, baseY + 13)) {
+    if (oledFrame.isPaused) {
+      u8g2.drawBox(0, baseY, 4, 12);
+      u8g2.drawBox(6, baseY, 4, 12);
+    } else {
+      u8g2.drawTriangle(0, baseY, 12, baseY + 6, 0, baseY + 12);
+    }
   }
 
   // Show speed
-  int curMinutes = ((unsigned long)uiState.songNoteTimes[uiState.currentSongNoteIdx] / 1000) / 60;
-  int curSeconds = ((unsigned long)uiState.songNoteTimes[uiState.currentSongNoteIdx] / 1000) % 60;
-  int durationMinutes = ((unsigned long)uiState.songDuration / 1000) / 60;
-  int durationSeconds = ((unsigned long)uiState.songDuration / 1000) % 60;
-  auto speedStr = SPEED_SETTINGS_STR[uiState.currentSpeedSettingIdx];
-  
   u8g2.setFont(u8g2_font_ncenB08_tr);
-  u8g2.setCursor(16, 50);
-  u8g2.printf("%02d:%02d/%02d:%02d (%s)", curMinutes, curSeconds, durationMinutes, durationSeconds, speedStr);
-  
+  if (rowsVisible(top, bottom, 50 - u8g2.getAscent(), 51 - u8g2.getDescent()))
+    u8g2.drawStr(16, 50, oledFrame.timeText);
+
   // Song progress
-  int progressX = (int)((uiState.songNoteTimes[uiState.currentSongNoteIdx] / uiState.songDuration) * 128);
-  u8g2.drawBox(0, 59, progressX, 3);
-  u8g2.drawBox(progressX, 60, 128, 1);
-  u8g2.drawBox(progressX-1, 56, 2, 8);
+  if (rowsVisible(top, bottom, 56, 64)) {
+    int progressX = oledFrame.progressX;
+    u8g2.drawBox(0, 59, progressX, 3);
+    u8g2.drawBox(progressX, 60, 128, 1);
+    u8g2.drawBox(progressX-1, 56, 2, 8);
+  }
 
   // Draw visualizer
   int barWidth = 128 / NUM_BANDS;
-  for (int i = 0; i < NUM_BANDS; i++) {
-    int barHeight = map(uiState.visualBands[i], 0, 255, 0,
-    				  BAR_PIXEL_BOT_Y - BAR_PIXEL_TOP_Y);
-    int x = i * barWidth;
-    int y = BAR_PIXEL_BOT_Y - barHeight;
-    u8g2.drawBox(x, y, barWidth - 1, barHeight);
+  if (rowsVisible(top, bottom, BAR_PIXEL_TOP_Y, BAR_PIXEL_BOT_Y)) {
+    for (int i = 0; i < NUM_BANDS; i++) {
+      int barHeight = oledFrame.barHeight[i];
+      if (rowsVisible(top, bottom, BAR_PIXEL_BOT_Y - barHeight, BAR_PIXEL_BOT_Y))
+        u8g2.drawBox(i * barWidth, BAR_PIXEL_BOT_Y - barHeight, barWidth - 1, barHeight);
+    }
+  }
+  // Mark the bands this song reaches at all
+  if (rowsVisible(top, bottom, BAR_PIXEL_BOT_Y + 2, BAR_PIXEL_BOT_Y + 3)) {
+    for (int i = 0; i < NUM_BANDS; i++)
+      if (oledFrame.bandMask & (1 << i))
+        u8g2.drawHLine(i * barWidth, BAR_PIXEL_BOT_Y + 2, barWidth - 1);
+  }
+}
+
+// The last frame sent, so an unchanged one (while paused, during a long
+// note) is not sent again
+decltype(oledFrame) oledShown;
+
+void drawUI_oled() {
+  if (oledRenderPages())
+    return;
+  // Previous frame still on the bus, rendering now would tear it
+  if (!oledDevice.idle())
+    return;
+  // Leave the splash up while playback has already started
+  if ((long)(millis() - splashUntil) < 0)
+    return;
+  if (displayIdle.level == DISPLAY_OFF)
+    return;
+  if (displayIdle.level != DISPLAY_FULL && millis() - displayIdle.lastFrameMs < DISPLAY_SLOW_FRAME_MS)
+    return;
+
+  bool newTitle = oledTitle.song != uiState.currentSong || oledTitle.name != uiState.songName;
+  if (newTitle)
+    oledRenderTitle();
+  uint32_t titleMs = millis() - oledTitle.startMs;
+  oledFrame.titleScroll = 0;
+  if (oledTitle.width > 128 && titleMs > OLED_TITLE_HOLD_MS)
+    oledFrame.titleScroll = (titleMs - OLED_TITLE_HOLD_MS) * OLED_TITLE_SPEED / 1000 % (oledTitle.width + OLED_TITLE_GAP);
+
+  oledFrame.isPaused = uiState.isPaused;
+
+  int curMinutes = ((unsigned long)uiState.songPositionMs / 1000) / 60;
+  int curSeconds = ((unsigned long)uiState.songPositionMs / 1000) % 60;
+  int durationMinutes = ((unsigned long)uiState.songDuration / 1000) / 60;
+  int durationSeconds = ((unsigned long)uiState.songDuration / 1000) % 60;
+  auto speedStr = SPEED_SETTINGS_STR[uiState.currentSpeedSettingIdx];
+  snprintf(oledFrame.timeText, sizeof(oledFrame.timeText), "%02d:%02d/%02d:%02d (%s)", curMinutes,
+           curSeconds, durationMinutes, durationSeconds, speedStr);
+
+  oledFrame.progressX = (int)((uiState.songPositionMs / uiState.songDuration) * 128);
+
+  for (int i = 0; i < NUM_BANDS; i++)
+    oledFrame.barHeight[i] = map(uiState.visualBands[i], 0, 255, 0, BAR_PIXEL_BOT_Y - BAR_PIXEL_TOP_Y);
+
+  oledFrame.bandMask = uiState.songBandMask;
+
+  if (!newTitle && memcmp(&oledFrame, &oledShown, sizeof(oledFrame)) == 0)
+    return;
+  memcpy(&oledShown, &oledFrame, sizeof(oledFrame));
+  displayIdle.lastFrameMs = millis();
+  oledRenderFrame(drawOledFrame);
+}
+
+// The LCD's bar mode: the name on the top row, and below it the visualizer
+// in 8-level bars on the left and the song progress in 1/5 cell steps on
+// the right, both from HD44780 custom glyphs. CGRAM slots 0-6 hold bars
+// of 1-7 pixel rows (8 is the ROM's full block), slot 7 the progress cell
+// being filled. Glyphs and cells only go out when they changed, so a frame
+// usually costs a few bytes of bus time.
+#define LCD_BAR_MODE 1
+#define LCD_VISUALIZER_CELLS 8
+#define LCD_PROGRESS_CELLS (16 - LCD_VISUALIZER_CELLS)
+#define LCD_GLYPH_BAR 8       // + level - 1, the slots as printRow() text
+#define LCD_GLYPH_PROGRESS 15
+#define LCD_FULL_BLOCK '\xFF'
+#define LCD_PROGRESS_TRACK '-'
+
+// The song name in 16 columns, scrolled through when it is longer
+void lcdSongNameRow(char *row) {
+  const char *songName = uiState.songName;
+  int songNameLength = strlen(songName);
+
+  if (songNameLength <= 16) {
+    snprintf(row, 17, "%s", songName);
+  } else {
+    uint32_t scrollTime = millis() - uiState.scrollTimeBegin;
+    int offset = 0;
+
+    const uint32_t T1 = 2000;
+    const uint32_t T2 = 8000;
+
+    if (scrollTime < 2000) {
+      offset = 0;
+    } else if (scrollTime >= T1 && scrollTime < T2) {
+      offset = ((scrollTime - T1) * (songNameLength + 1)) / (T2 - T1);
+    } else if (scrollTime >= T2) {
+      uiState.scrollTimeBegin = millis();
+    }
+
+    for (int i = 0; i < 16; i++) {
+      row[i] = songName[(offset + i) % (songNameLength + 1)];
+      if (row[i] == '\0')
+        row[i] = ' ';
+    }
+    row[16] = '\0';
+  }
+}
+
+#if LCD_BAR_MODE
+// Returns false while a glyph still has to go out
+bool lcdDefineGlyphs(uint8_t progressColumns) {
+  uint8_t pixels[8];
+  for (uint8_t level = 1; level < 8; level++) {
+    for (uint8_t y = 0; y < 8; y++)
+      pixels[y] = y >= 8 - level ? 0x1F : 0;
+    if (!lcd->defineChar(LCD_GLYPH_BAR + level - 1, pixels))
+      return false;
   }
 
-  u8g2.sendBuffer();
+  // The filled columns from the left, over the track of '-' (its row 3)
+  uint8_t filled = (0x1F << (5 - progressColumns)) & 0x1F;
+  for (uint8_t y = 0; y < 8; y++)
+    pixels[y] = y == 3 ? 0x1F : filled;
+  return lcd->defineChar(LCD_GLYPH_PROGRESS, pixels);
 }
 
+void lcdBarRow(char *row) {
+  // Each cell shows the louder of its bands, 0-8 pixel rows
+  const uint8_t bandsPerCell = NUM_BANDS / LCD_VISUALIZER_CELLS;
+  for (uint8_t cell = 0; cell < LCD_VISUALIZER_CELLS; cell++) {
+    uint8_t level = 0;
+    for (uint8_t b = 0; b < bandsPerCell; b++)
+      level = max(level, uiState.visualBands[cell * bandsPerCell + b]);
+    uint8_t rows = level * 9 / 256;
+    row[cell] = rows == 0 ? ' ' : rows == 8 ? LCD_FULL_BLOCK : LCD_GLYPH_BAR + rows - 1;
+  }
+
+  uint16_t steps = LCD_PROGRESS_CELLS * 5;
+  uint16_t done = uiState.songDuration > 0 ? uiState.songPositionMs / uiState.songDuration * steps : 0;
+  done = min(done, steps);
+  char *progress = row + LCD_VISUALIZER_CELLS;
+  for (uint8_t cell = 0; cell < LCD_PROGRESS_CELLS; cell++) {
+    if (done >= (cell + 1) * 5)
+      progress[cell] = LCD_FULL_BLOCK;
+    else if (done >= cell * 5)
+      progress[cell] = LCD_GLYPH_PROGRESS;
+    else
+      progress[cell] = LCD_PROGRESS_TRACK;
+  }
+  row[16] = '\0';
+
+  // The partial cell's glyph only changes with the step inside it; a glyph
+  // that cannot go out yet is retried with the next frame
+  if (!lcdDefineGlyphs(done < steps ? done % 5 : 0))
+    memset(row, ' ', 16);
+}
+#endif
+
 void drawUI_lcd() {
   if (lcd) {
-    const Song &song = *all_songs[uiState.currentSong];
-    lcd->clear();
-    lcd->setCursor(0, 0);
-    lcd->printf("Song (%d/%d):", uiState.currentSong+1, song_count);
-
-    int songNameLength = strlen(song.name);
+    bool dark = displayIdle.level == DISPLAY_OFF;
+    if (dark != displayIdle.lcdDark && lcd->ready()) {
+      if (dark)
+        lcd->noBacklight();
+      else
+        lcd->backlight();
+      displayIdle.lcdDark = dark;
+    }
+    // Nothing to see without the backlight
+    if (dark) {
+      lcd->service();
+      return;
+    }
 
-    lcd->setCursor(0, 1);
-    if (songNameLength <= 16) {
-      lcd->printf("%s", song.name);
-    } else {
-      uint32_t scrollTime = millis() - uiState.scrollTimeBegin;
-      char songNameBuffer[17] = {};
-      int offset = 0;
-
-      const uint32_t T1 = 2000;
-      const uint32_t T2 = 8000;
-
-      if (scrollTime < 2000) {
-        offset = 0;
-      } else if (scrollTime >= T1 && scrollTime < T2) {
-        offset = ((scrollTime - T1) * (songNameLength + 1)) / (T2 - T1);
-      } else if (scrollTime >= T2) {
-        uiState.scrollTimeBegin = millis();
-      }
+    char row[17] = {};
+#if LCD_BAR_MODE
+    lcdSongNameRow(row);
+    lcd->printRow(0, row);
+    lcdBarRow(row);
+    lcd->printRow(1, row);
+#else
+    snprintf(row, sizeof(row), "Song (%d/%d):", uiState.currentSong+1, catalogSize());
+    lcd->printRow(0, row);
+    lcdSongNameRow(row);
+    lcd->printRow(1, row);
+#endif
+
+    // Only the cells whose text changed go out, as one burst per row
+    lcd->service();
+  }
+}
 
-      for (int i = 0; i < 16; i++) {
-        songNameBuffer[i] = song.name[(offset + i) % (songNameLength + 1)];
-        if (songNameBuffer[i] == '\0')
-          songNameBuffer[i] = ' ';
-      }
+void reportI2CStats() {
+#if I2C_STATS_REPORT_MS
+  static unsigned long lastReport = 0;
+  if (millis() - lastReport >= I2C_STATS_REPORT_MS) {
+    lastReport = millis();
+    i2cBus.printStats(Serial);
+    i2cBus.resetStats();
+  }
+#endif
+}
 
-      lcd->printf("%s", songNameBuffer);
-    }
+void reportRam() {
+#if RAM_REPORT_MS
+  static unsigned long lastReport = 0;
+  if (millis() - lastReport >= RAM_REPORT_MS) {
+    lastReport = millis();
+    ramReportPending = true;
   }
+#endif
+  if (serialUpload.takeQuery())
+    ramReportPending = true;
+  if (ramReportPending) {
+    ramBudget.report(Serial);
+    runtimeArena.report(Serial, runtimeArenaNames);
+#if TONE_ARPEGGIO
+    buzzer.reportArpeggio(Serial);
+#endif
+#if LINE_IN_ANALYZER
+    lineIn.report(Serial);
+#endif
+    clockScaler.report(Serial);
+    ramReportPending = false;
+  }
+}
+
+void registerRamBudget() {
+  ramBudget.add("oled framebuffer", 8 * u8g2.getBufferTileWidth() * u8g2.getBufferTileHeight());
+  ramBudget.add("oled driver", sizeof(u8g2));
+  ramBudget.add("i2c bus", sizeof(i2cBus) + sizeof(oledDevice));
+  ramBudget.add("resume journal", sizeof(resumeJournal));
+  ramBudget.add("song stream", sizeof(songFlash) + sizeof(songBank) + sizeof(songStream));
+  ramBudget.add("serial upload", sizeof(serialUpload) + sizeof(uploadStorage) + sizeof(uploadBank));
+  ramBudget.add("telemetry", sizeof(telemetry));
+  ramBudget.add("clock scaler", sizeof(clockScaler));
+#if TRACE
+  ramBudget.add("trace", sizeof(trace));
+#endif
+  ramBudget.add("ui state", sizeof(uiState));
+  ramBudget.add("oled title", sizeof(oledTitle));
+  ramBudget.add("display idle", sizeof(displayIdle) + sizeof(oledShown));
+  ramBudget.add("song plans", sizeof(songPlans));
+  ramBudget.add("runtime arena", sizeof(runtimeArena));
+#if LINE_IN_ANALYZER
+  ramBudget.add("line-in analyzer", sizeof(lineIn));
+#endif
 }
 
 void drawUI() {
+  uint32_t frameStart = micros();
+  i2cBus.service();
+  updateDisplayPower();
   drawUI_lcd();
   drawUI_oled();
+  reportI2CStats();
+  reportRam();
+  telemetry.frame(frameStart, micros() - frameStart);
+  telemetry.service();
 }
 
-int checkJoystickX() {
-  int joystickX = analogRead(JOYSTICK_Y_PIN);
-  // Neutral by default
-  int currentJoystickXDirection = 0;
-  int flick = 0;
-  
-  if (joystickX > 950) {
-    currentJoystickXDirection = 1; // Right
-  } else if (joystickX < 250) {
-    currentJoystickXDirection = -1; // Left
+// Runs in the sampler's interrupt
+void onInput(InputKind kind, int8_t value, uint32_t timeUs) {
+  displayIdle.lastInputMs = millis();
+  clockScaler.boost();
+  static const TelemetryInput telemetryInputs[] = {TELEMETRY_INPUT_SKIP, TELEMETRY_INPUT_SPEED, TELEMETRY_INPUT_PAUSE};
+  inputLatency.input = telemetryInputs[kind];
+  inputLatency.inputUs = timeUs;
+  inputLatency.audibleUs = inputLatency.handledUs = 0;
+  inputLatency.open = true;
+
+  if (kind == INPUT_SKIP) {
+    buzzer.stop();
+  } else if (kind == INPUT_PAUSE) {
+    pauseRequested = !pauseRequested;
+    if (pauseRequested)
+      buzzer.hold();
+    else
+      buzzer.release();
+  } else {
+    return; // speed changes are heard once the loop rescales the note
   }
+  inputLatency.audibleUs = micros();
+}
+
+void reportInputLatency(uint32_t noteUs) {
+  telemetry.latency(inputLatency.input, inputLatency.inputUs, inputLatency.audibleUs - inputLatency.inputUs,
+                    inputLatency.handledUs - inputLatency.inputUs, noteUs ? noteUs - inputLatency.inputUs : 0);
+  inputLatency.open = false;
+}
 
-  unsigned long currentTime = millis();
+// Skips stay open until the next song's first note
+void inputHandled(TelemetryInput input) {
+  noInterrupts();
+  bool current = inputLatency.open && inputLatency.input == input && inputLatency.handledUs == 0;
+  interrupts();
+  if (!current)
+    return;
+  inputLatency.handledUs = micros();
+  if (input == TELEMETRY_INPUT_SPEED)
+    inputLatency.audibleUs = inputLatency.handledUs;
+  if (input != TELEMETRY_INPUT_SKIP)
+    reportInputLatency(0);
+}
 
-  // Only skip if direction changed OR the last skip was 1.5secs ago (timer-based skipping if held)
-  if ((currentJoystickXDirection != lastJoystickXDirection) ||
-	  (currentTime - lastJoystickXFlick >= SKIP_INTERVAL)) {
-	  lastJoystickXFlick = currentTime;
-	  flick = currentJoystickXDirection;
+// The interrupt may pause between a note's pause check and its start
+void holdIfPaused() {
+  noInterrupts();
+  if (pauseRequested)
+    buzzer.hold();
+  interrupts();
+}
+
+int checkJoystickX() {
+  uint32_t timeUs;
+  int8_t flick = inputs.take(INPUT_SKIP, &timeUs);
+  if (flick != 0) {
+    skipRequested = true;
+    inputHandled(TELEMETRY_INPUT_SKIP);
+    telemetry.input(TELEMETRY_INPUT_SKIP, flick, timeUs);
   }
-  lastJoystickXDirection = currentJoystickXDirection;
   return flick;
 }
 
 int checkJoystickY() {
-  int joystickY = analogRead(JOYSTICK_X_PIN);
-  // Neutral by default
-  int currentJoystickYDirection = 0;
-  int flick = 0;
-  
-  if (joystickY > 950) {
-    currentJoystickYDirection = 1; // Up
-  } else if (joystickY < 250) {
-    currentJoystickYDirection = -1; // Down
-  }
-
-  unsigned long currentTime = millis();
-
-  // Only skip if direction changed OR the last skip was 1.5secs ago (timer-based skipping if held)
-  if ((currentJoystickYDirection != lastJoystickYDirection) ||
-	  (currentTime - lastJoystickYFlick >= SKIP_INTERVAL)) {
-	  lastJoystickYFlick = currentTime;
-	  flick = currentJoystickYDirection;
+  uint32_t timeUs;
+  int8_t flick = inputs.take(INPUT_SPEED, &timeUs);
+  if (flick != 0) {
+    inputHandled(TELEMETRY_INPUT_SPEED);
+    telemetry.input(TELEMETRY_INPUT_SPEED, flick, timeUs);
   }
-  lastJoystickYDirection = currentJoystickYDirection;
   return flick;
 }
 
 bool checkPauseButton() {
-  static unsigned long lastPressTime = 0;
-  static int lastStableReading = HIGH;
-  int reading = digitalRead(PAUSE_BUTTON_PIN);
-  unsigned long currentTime = millis();
-  
-  // Simple debounce: if button state changed, reset debounce timer
-  if (reading != lastButtonState) {
-    lastDebounceTime = currentTime;
-  }
-  
-  lastButtonState = reading;
-  
-  // Only process if debounce time has passed
-  if ((currentTime - lastDebounceTime) > DEBOUNCE_DELAY) {
-    // Detect button press (HIGH to LOW transition) with cooldown
-    if (reading == LOW && lastStableReading == HIGH && 
-        (currentTime - lastPressTime) > BUTTON_PRESS_COOLDOWN) {
-      lastStableReading = LOW;
-      lastPressTime = currentTime;
-      return true; // Button was just pressed
-    }
-    
-    // Update stable reading on release
-    if (reading == HIGH) {
-      lastStableReading = HIGH;
-    }
-  }
-  
-  return false;
+  uint32_t timeUs;
+  if (inputs.take(INPUT_PAUSE, &timeUs) == 0)
+    return false;
+  inputHandled(TELEMETRY_INPUT_PAUSE);
+  telemetry.input(TELEMETRY_INPUT_PAUSE, 1, timeUs);
+  return true;
 }
 
+// The pause state belongs to the sampler's interrupt, which has already
+// silenced or resumed the buzzer; this only follows it
 int handlePauseOrSkipReq() {
     int skip = 0;
-    bool isPaused = false;
 
     if ((skip = checkJoystickX()) != 0)
       return skip;
-    if (checkPauseButton())
-      isPaused = true;
+    checkPauseButton();
 
-    while (isPaused) {
-      if ((skip = checkJoystickX()) != 0)
+    while (pauseRequested) {
+      if ((skip = checkJoystickX()) != 0) {
+        pauseRequested = false;
         return skip;
+      }
       // press again to unpause
-      if (checkPauseButton())
-        isPaused = false;
+      checkPauseButton();
 
       // Update visualizer with rest (no note) while paused
       updateVisualizer(REST);
       uiState.isPaused = true;
+      player.scheduleValid = false;
       drawUI();
-      delay(20); // Small delay to prevent tight loop
+      telemetry.loopIteration();
+      serviceUpload();
+      // A paused unit may well be switched off next
+      resumeJournal.flush(true);
+      loopIdle(20); // Small delay to prevent tight loop
     }
-    
+
+    if (uiState.isPaused)
+      traceAnchor(uiState.currentSongNoteIdx + 1, SPEED_SETTINGS_PERMILLE[uiState.currentSpeedSettingIdx]);
     uiState.isPaused = false;
     return 0;
 }
 
-// Returns how many songs to skip
-int playSong(int songIndex) {
-  int skip = 0;
-  int speedSettingIdx = 2;
-  int speedChange = 0;
+// Starts the melody note and the track voices of one row together. A voice
+// tied into the next row sounds on through this one's end; a tie in the
+// first row played starts the note it continues. With a single buzzer the
+// row is played as a chord, its tones taking turns.
+void playRow(const Song &song, unsigned int noteIdx, bool first, uint16_t melody, uint32_t durationMs) {
+#if TONE_ARPEGGIO
+  uint16_t tones[TONE_ARPEGGIO_TONES];
+  uint8_t count = 0;
+  if (melody != 0)
+    tones[count++] = melody;
+  for (uint8_t voice = 0; voice < song.tracks->voices && count < TONE_ARPEGGIO_TONES; voice++) {
+    uint16_t pitch = songTrackPitch(song, noteIdx, voice);
+    if (pitch != 0 && pitch != melody)
+      tones[count++] = pitch;
+  }
+  clockForNotes(tones, count);
+  if (count != 0)
+    buzzer.playChord(tones, count, durationMs);
+#else
+  uint16_t frequencies[TONE_VOICES] = {melody};
+  uint8_t sustainMask = 0;
+  for (uint8_t voice = 1; voice < TONE_VOICES; voice++) {
+    bool tied = !first && songTrackTied(song, noteIdx, voice - 1);
+    frequencies[voice] = tied ? TONE_TIE : songTrackPitch(song, noteIdx, voice - 1);
+    if (songTrackTied(song, noteIdx + 1, voice - 1))
+      sustainMask |= 1 << voice;
+  }
+  clockForNotes(frequencies, TONE_VOICES);
+  buzzer.playVoices(frequencies, durationMs, sustainMask);
+#endif
+}
 
-  const Song &song = *all_songs[songIndex];
+// What the note loop plays on (see player.h): the buzzer, the inputs and
+// the rest of the firmware's loop
+struct FirmwareBoard {
+  SongPlan &plan;
+  bool streamed;
 
-  uiState.currentSong = songIndex;
-  songCumSum(song, uiState.songNoteTimes);
-  uiState.songDuration = uiState.songNoteTimes[song.length - 1];
-  uiState.scrollTimeBegin = millis();
-  uiState.currentSpeedSettingIdx = speedSettingIdx;
-  uiState.isPaused = false;
-  drawUI();
+  explicit FirmwareBoard(SongPlan &plan) : plan(plan), streamed(plan.song == nullptr) {}
 
-  for (unsigned int noteIdx = 0; noteIdx < song.length; noteIdx++) {
+  uint32_t micros() { return ::micros(); }
+
+  void noteDue(unsigned int noteIdx) {
     uiState.currentSongNoteIdx = noteIdx;
+    uiState.songPositionMs = player.positionMs;
+  }
 
-    if ((skip = handlePauseOrSkipReq()) != 0)
-      return skip;
+  bool nextNote(int &frequency, int &divider) {
+    return streamed ? songStream.next(frequency, divider) : songCursorNext(plan.cursor, frequency, divider);
+  }
+
+  int pauseOrSkip() { return handlePauseOrSkipReq(); }
+  int speedChange() { return checkJoystickY(); }
+
+  void noteStarting(unsigned int noteIdx, int frequency, uint32_t scheduleUs, uint32_t onsetUs, uint32_t durationMs) {
+    telemetry.note(plan.index, noteIdx, scheduleUs, onsetUs);
+    if (inputLatency.open && inputLatency.input == TELEMETRY_INPUT_SKIP && inputLatency.handledUs != 0)
+      reportInputLatency(onsetUs);
+    traceNote(onsetUs, noteIdx, frequency, onsetUs + durationMs * 1000);
+  }
 
-    Note note = songGetNote(song, noteIdx);
-    note.durationMs /= SPEED_SETTINGS[speedSettingIdx];
-    if (note.frequency != 0) {
-      tone(BUZZER_PIN, note.frequency, (unsigned long)note.durationMs);
+  void startNote(unsigned int noteIdx, bool first, int frequency, uint32_t durationMs) {
+    // Streamed songs are melodies alone
+    if (!streamed && plan.song->tracks != nullptr) {
+      playRow(*plan.song, noteIdx, first, frequency, durationMs);
+      holdIfPaused();
+    } else if (frequency != 0) {
+      uint16_t frequencies[] = {(uint16_t)frequency};
+      clockForNotes(frequencies, 1);
+      buzzer.play(frequency, durationMs);
+      holdIfPaused();
     }
+    if (frequency != 0 && bootFirstNoteMs == 0)
+      reportBootTime();
+
+    // Journal writes run once the note or rest has started, so the flash
+    // stall eats into its duration instead of delaying the onset. Erases
+    // only happen in rests long enough to hide them.
+    ResumeState position;
+    position.song = plan.index;
+    position.speedSettingIdx = player.speedSettingIdx;
+    position.noteIdx = noteIdx;
+    resumeJournal.record(position);
+    resumeJournal.service(frequency == REST && durationMs >= RESUME_ERASE_MIN_REST_MS);
+  }
 
-	// Update visualizer during note
-    unsigned long noteStart = millis();
-    while (millis() - noteStart < note.durationMs) {
-      if ((skip = handlePauseOrSkipReq()) != 0)
-        return skip;
+  void speedChanged(unsigned int noteIdx) {
+    uiState.currentSpeedSettingIdx = player.speedSettingIdx;
+    traceAnchor(noteIdx + 1, player.speed());
+  }
 
-      if ((speedChange = checkJoystickY()) != 0) {
-        speedSettingIdx = constrain(speedSettingIdx + speedChange, 0, SPEED_SETTINGS_MAX_IDX);
-        uiState.currentSpeedSettingIdx = speedSettingIdx;
-      }
+  void setRemaining(unsigned int noteIdx, uint32_t leftUs, uint32_t stopUs) {
+    buzzer.setRemaining(leftUs / 1000);
+    traceRetime(noteIdx, stopUs);
+  }
 
-      updateVisualizer(note.frequency);
-      drawUI();
-      delay(20);
+  void notePlaying(int frequency) {
+    updateVisualizer(frequency);
+    drawUI();
+    telemetry.loopIteration();
+    serviceUpload();
+    // Read ahead while the note plays, so the next one is already in RAM
+    if (streamed)
+      songStream.fill();
+    if (nextPlan->index < 0 && player.prefetchDue(plan.durationMs))
+      prepareSong(*nextPlan, followingSong(plan.index));
+  }
+
+  void idle(uint32_t ms) { loopIdle(ms); }
+
+  // A frame could overrun a short gap
+  void gapPassing() {
+    i2cBus.service();
+    telemetry.service();
+    serviceUpload();
+  }
+};
+
+// Returns how many songs to skip
+int playSong(SongPlan &plan, unsigned int startNoteIdx = 0, int speedSettingIdx = 2) {
+  FirmwareBoard board(plan);
+  unsigned int tempo = plan.tempo;
+  player.positionMs = 0;
+
+  if (board.streamed) {
+    if (!songStream.open(*plan.bank, plan.bankIndex))
+      return 1;
+    // Resuming mid-song: read through the skipped notes for their durations
+    int frequency, divider;
+    for (unsigned int i = 0; i < startNoteIdx && songStream.next(frequency, divider); i++) {
+      player.positionMs += noteDuration(divider, tempo);
+      songStream.fill();
     }
+  } else {
+    int frequency, divider;
+    for (unsigned int i = 0; i < startNoteIdx && songCursorNext(plan.cursor, frequency, divider); i++)
+      player.positionMs += noteDuration(divider, tempo);
   }
 
-  return 1;
-}
+  // The first frame is drawn once the first note sounds
+  player.speedSettingIdx = speedSettingIdx;
+  uiState.currentSong = plan.index;
+  uiState.songName = plan.name;
+  uiState.songDuration = plan.durationMs;
+  uiState.songBandMask = plan.bandMask;
+  traceSong(plan.index, player.speed());
+  uiState.scrollTimeBegin = millis();
+  uiState.currentSpeedSettingIdx = speedSettingIdx;
+  uiState.isPaused = false;
 
-int mod(int a, int b) {
-  return (a % b + b) % b;
+  return player.play(board, startNoteIdx, plan.length, tempo);
 }
 
-void setup() {
-  Serial.begin(9600);
-  Wire.begin();
-
+void setupDisplaysBlocking() {
   // Scan for LCD 1602 I2C address
   uint8_t lcdAddress = scanI2CForLCD();
   if (lcdAddress != 0) {
-    lcd = new LiquidCrystal_I2C(lcdAddress, 16, 2);
-    lcd->init();
-    lcd->backlight();
+    lcd = runtimeArena.create<ARENA_LCD>(i2cBus, lcdAddress, 16, 2);
+    lcd->begin();
     // Display will be updated by updateSongDisplay
-    lcd->setCursor(0, 1);
-    lcd->print("Initializing...  ");
+    lcd->printRow(1, "Initializing...");
   }
 
-  pinMode(BUZZER_PIN, OUTPUT);
-  pinMode(JOYSTICK_X_PIN, INPUT);
-  pinMode(JOYSTICK_Y_PIN, INPUT);
-  pinMode(PAUSE_BUTTON_PIN, INPUT_PULLUP);
-  
-  // Initialize button state
-  lastButtonState = digitalRead(PAUSE_BUTTON_PIN);
-
-  // Init OLED and show startup message
+  // Init OLED and show startup message. u8g2.begin() talks to Wire directly,
+  // so the bus has to be idle; frames go through the scheduler afterwards.
+  i2cBus.drain();
   u8g2.begin();
-  u8g2.clearBuffer();
-  u8g2.setFont(u8g2_font_ncenB08_tr);
-  u8g2.drawStr(20, 32, "Music Player");
-  u8g2.setCursor(20, 30);
-  u8g2.sendBuffer();
-  delay(800);
+  i2cBus.attach(oledDevice);
+  oledRenderFrameNow(drawSplash);
+  delay(SPLASH_MS);
+}
+
+void setupDisplaysFast() {
+  uint8_t lcdAddress = findLCDCached();
 
-  int longest = 0;
-  for (int i = 0; i < song_count; i++)
-    if (songs[i]->length > longest)
-      longest = songs[i]->length;
+  // Only the short OLED init sequence is blocking. Instead of u8g2's blocking
+  // clearDisplay(), the splash frame overwrites the panel RAM through the bus
+  // before it is switched on.
+  u8g2.initDisplay();
+  i2cBus.attach(oledDevice);
+  oledRenderFrameNow(drawSplash);
+  oledSubmitDisplayOn();
+  splashUntil = millis() + SPLASH_MS;
 
-  uiState.songNoteTimes = (float*)malloc(longest * sizeof(float));
+  // Power-on waits of the HD44780 run as bus hold-offs from here on
+  if (lcdAddress != 0) {
+    lcd = runtimeArena.create<ARENA_LCD>(i2cBus, lcdAddress, 16, 2);
+    lcd->beginAsync();
+  }
+}
+
+void setup() {
+  ramBudget.begin();
+  Serial.begin(SERIAL_BAUD);
+  serialUpload.begin(Serial);
+#if TELEMETRY
+  telemetry.begin();
+  i2cBus.setObserver(onI2CTransfer);
+#endif
+  Wire.begin();
+  i2cBus.begin(Wire);
+
+  buzzer.begin();
+#if TONE_TABLE_REPORT
+  ToneTimer::report(Serial);
+#endif
+  pinMode(PAUSE_BUTTON_PIN, INPUT_PULLUP);
+  // Skips on A1 and speed on A0, as with analogRead() before
+  inputs.setHandler(onInput);
+  inputs.begin(PAUSE_BUTTON_PIN, JOYSTICK_Y_ADC_CHANNEL, JOYSTICK_X_ADC_CHANNEL);
+#if LINE_IN_ANALYZER
+  lineIn.begin(LINE_IN_ADC_CHANNEL, song_band_boundaries);
+#endif
+
+#if FAST_BOOT
+  setupDisplaysFast();
+#else
+  setupDisplaysBlocking();
+#endif
+
+  if (songFlash.begin())
+    songBank.begin(songFlash);
+  registerRamBudget();
+#if CLOCK_SCALING
+  clockScaler.begin(onClockChanged, CLOCK_LOWEST_PROFILE);
+#endif
 
   int currentSong = 0;
+  unsigned int startNoteIdx = 0;
+  int speedSettingIdx = 2;
+  if (resumeJournal.begin()) {
+    const ResumeState &resume = resumeJournal.state();
+    // Streamed songs check the note index when they are opened
+    bool noteValid = resume.song >= song_count || resume.noteIdx < song_toc[resume.song].length;
+    if (resume.song < catalogSize() && noteValid &&
+        resume.speedSettingIdx <= SPEED_SETTINGS_MAX_IDX) {
+      currentSong = resume.song;
+      startNoteIdx = resume.noteIdx;
+      speedSettingIdx = resume.speedSettingIdx;
+    }
+  }
+
+  SongPlan *plan = &songPlans[1];
+  prepareSong(*plan, currentSong);
   for (;;) {
-    int skipDirection = playSong(currentSong);
-    currentSong = mod(currentSong + skipDirection, song_count);
-    delay(200);
+    int skipDirection = plan->index >= 0 ? playSong(*plan, startNoteIdx, speedSettingIdx) : 1;
+    traceDump();
+    // A skip back still goes back, the upload stays queued for the next
+    // song that ends or is skipped forward
+    if (uploadQueued && skipDirection == 1) {
+      currentSong = uploadedSongIndex();
+      uploadQueued = false;
+    } else {
+      currentSong = mod(currentSong + skipDirection, catalogSize());
+    }
+    // Refuse a new upload while the uploaded song streams from the buffer
+    serialUpload.setLocked(currentSong >= (int)uploadedSongIndex());
+    startNoteIdx = 0;
+    speedSettingIdx = 2;
+
+    // Normally prepared already; a skip back or a late upload is not
+    SongPlan *finished = plan;
+    plan = nextPlan;
+    nextPlan = finished;
+    nextPlan->index = -1;
+    if (plan->index != currentSong)
+      prepareSong(*plan, currentSong);
+
+    // A skip goes straight to the next song, a song that ended keeps the
+    // note schedule running into the next one
+    resumeJournal.service(!skipRequested && SONG_GAP_MS >= RESUME_ERASE_MIN_REST_MS);
+    if (skipRequested) {
+      player.scheduleValid = false;
+    } else if (player.scheduleValid) {
+      FirmwareBoard gap(*plan);
+      player.waitForGap(gap);
+    }
+    skipRequested = false;
   }
 }
 
@@ -0,0 +1,140 @@
+#pragma once
+#include <stdint.h>
+#include "note.h"
+#include "tempo.h"
+
+// The note loop of playSong(): score time per note, the tempo ramp, the
+// note schedule kept across rests, pauses and songs, and what is left of
+// the sounding note after a pause or a speed change. Plain C++ on a Board
+// that supplies the clock, the notes, the buzzer and the rest of the loop,
+// so tools/playsim.cpp runs the same timing on the host with a virtual
+// clock. A Board has:
+//
+//   uint32_t micros();
+//   void noteDue(unsigned int noteIdx);  before the pause check of each note
+//   bool nextNote(int &frequency, int &divider);
+//   int pauseOrSkip();       songs to skip, 0 to go on; may pause in between
+//   int speedChange();       steps of a speed flick, 0 for none
+//   void noteStarting(unsigned int noteIdx, int frequency, uint32_t scheduleUs, uint32_t onsetUs,
+//                     uint32_t durationMs);
+//   void startNote(unsigned int noteIdx, bool first, int frequency, uint32_t durationMs);
+//   void speedChanged(unsigned int noteIdx);
+//   void setRemaining(unsigned int noteIdx, uint32_t leftUs, uint32_t stopUs);
+//   void notePlaying(int frequency);    one loop pass: UI, bus, prefetch
+//   void idle(uint32_t ms);             loopIdle()
+//   void gapPassing();                  bus and serial work between songs
+
+// The next song is worked out while the current one plays its last
+// SONG_PREFETCH_MS: metadata, name and, for built-in songs, the note cursor.
+// Its first note then lands SONG_GAP_MS (0 for none) after the last note of
+// the current one ended, with nothing left to do at the boundary.
+#define SONG_GAP_MS 200
+#define SONG_PREFETCH_MS 3000
+// Each pass of the note loop ends with this much idle time
+#define PLAYER_IDLE_MS 20
+
+class NotePlayer {
+public:
+  TempoRamp ramp;
+  uint8_t speedSettingIdx = 2;
+  // Real time the next note is due; invalid after a pause or a skip, the
+  // next note then starts a new schedule
+  uint32_t scheduleUs = 0;
+  bool scheduleValid = false;
+  // Score time into the song, up to the end of the note playing
+  float positionMs = 0;
+
+  uint16_t speed() const { return SPEED_SETTINGS_PERMILLE[speedSettingIdx]; }
+
+  // Whether the next song should be prepared now
+  bool prefetchDue(uint32_t songDurationMs) const { return songDurationMs - positionMs < SONG_PREFETCH_MS; }
+
+  // Plays notes from noteIdx on, until the song has length notes or a skip;
+  // returns the songs to skip. positionMs is where noteIdx starts.
+  template <class Board>
+  int play(Board &board, unsigned int noteIdx, unsigned int length, unsigned int tempo);
+
+  // Holds the next song's first note until SONG_GAP_MS after the last one's
+  // scheduled end
+  template <class Board>
+  void waitForGap(Board &board);
+};
+
+template <class Board>
+int NotePlayer::play(Board &board, unsigned int noteIdx, unsigned int length, unsigned int tempo) {
+  int skip = 0;
+  unsigned int firstNoteIdx = noteIdx;
+  ramp.jump(speed());
+
+  for (; noteIdx < length; noteIdx++) {
+    board.noteDue(noteIdx);
+    if ((skip = board.pauseOrSkip()) != 0)
+      return skip;
+
+    int frequency, divider;
+    if (!board.nextNote(frequency, divider))
+      break;
+    float scoreMs = noteDuration(divider, tempo);
+    positionMs += scoreMs;
+    uint32_t noteScoreUs = (uint32_t)(scoreMs * 1000);
+    uint32_t noteRealUs = scoreToRealUs(noteScoreUs, ramp.at(board.micros()));
+
+    uint32_t onsetUs = board.micros();
+    if (!scheduleValid) {
+      scheduleUs = onsetUs;
+      scheduleValid = true;
+    }
+    board.noteStarting(noteIdx, frequency, scheduleUs, onsetUs, noteRealUs / 1000);
+    scheduleUs += noteRealUs;
+    board.startNote(noteIdx, noteIdx == firstNoteIdx, frequency, noteRealUs / 1000);
+
+    uint32_t playedScoreUs = 0;
+    uint32_t lastUs = onsetUs;
+    while (true) {
+      // Trapezoid over the last iteration, exact for a linear ramp
+      uint32_t nowUs = board.micros();
+      playedScoreUs += realToScoreUs(nowUs - lastUs, (ramp.at(lastUs) + ramp.at(nowUs)) / 2);
+      lastUs = nowUs;
+      if (playedScoreUs >= noteScoreUs)
+        break;
+
+      if ((skip = board.pauseOrSkip()) != 0)
+        return skip;
+
+      // Back from a pause: paused time does not count, and the note, which
+      // the interrupt resumed, gets what is left of it
+      bool resumed = !scheduleValid;
+      if (resumed)
+        lastUs = board.micros();
+
+      bool retime = false;
+      int change = board.speedChange();
+      if (change != 0) {
+        int idx = speedSettingIdx + change;
+        speedSettingIdx = idx < 0 ? 0 : idx > SPEED_SETTINGS_MAX_IDX ? SPEED_SETTINGS_MAX_IDX : idx;
+        ramp.glide(speed(), lastUs);
+        board.speedChanged(noteIdx);
+        retime = true;
+      }
+
+      if (resumed || retime || ramp.active(lastUs)) {
+        uint32_t leftUs = scoreToRealUs(noteScoreUs - playedScoreUs, ramp.at(lastUs));
+        scheduleUs = lastUs + leftUs;
+        scheduleValid = true;
+        board.setRemaining(noteIdx, leftUs, lastUs + leftUs / 1000 * 1000);
+      }
+
+      board.notePlaying(frequency);
+      board.idle(PLAYER_IDLE_MS);
+    }
+  }
+
+  return 1;
+}
+
+template <class Board>
+void NotePlayer::waitForGap(Board &board) {
+  scheduleUs += SONG_GAP_MS * 1000UL;
+  while ((int32_t)(scheduleUs - board.micros()) > 0)
+    board.gapPassing();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+
+// Playback speeds in per mille, for the note timing
+const uint16_t SPEED_SETTINGS_PERMILLE[] = {250, 500, 1000, 1500, 2000, 3000};
+const uint8_t SPEED_SETTINGS_MAX_IDX = sizeof(SPEED_SETTINGS_PERMILLE) / sizeof(SPEED_SETTINGS_PERMILLE[0]) - 1;
+
+// Notes are timed in score time, microseconds at 1.0x, so a speed change
+// rescales what is left of the sounding note at once. With TEMPO_RAMP_MS
+// set, speed changes glide linearly to the new setting over that long.
+#ifndef TEMPO_RAMP_MS
+#define TEMPO_RAMP_MS 0
+#endif
+
+struct TempoRamp {
+  uint16_t from = 1000;
+  uint16_t to = 1000;
+  uint32_t startUs = 0;
+
+  void jump(uint16_t speed) {
+    from = to = speed;
+  }
+
+  void glide(uint16_t speed, uint32_t nowUs) {
+    from = at(nowUs);
+    to = speed;
+    startUs = nowUs;
+  }
+
+  bool active(uint32_t nowUs) const {
+    return from != to && (nowUs - startUs) / 1000 < TEMPO_RAMP_MS;
+  }
+
+  // Speed in per mille
+  uint16_t at(uint32_t nowUs) const {
+#if TEMPO_RAMP_MS
+    uint32_t elapsedMs = (nowUs - startUs) / 1000;
+    if (elapsedMs < TEMPO_RAMP_MS)
+      return from + ((int32_t)to - from) * (int32_t)elapsedMs / TEMPO_RAMP_MS;
+#endif
+    return to;
+  }
+};
+
+// Split so the intermediate products stay within 32 bits
+inline uint32_t scoreToRealUs(uint32_t scoreUs, uint16_t speedPermille) {
+  return scoreUs / speedPermille * 1000 + scoreUs % speedPermille * 1000 / speedPermille;
+}
+
+inline uint32_t realToScoreUs(uint32_t realUs, uint16_t speedPermille) {
+  return realUs / 1000 * speedPermille + realUs % 1000 * speedPermille / 1000;
+}
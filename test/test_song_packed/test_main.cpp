@@ -0,0 +1,165 @@
+// Host tests for the packed song format: pio test -e native
+//
+// Decodes every song tools/pack_songs.py generated and compares it with the
+// plain melody it was packed from, then feeds the cursor hand-made streams
+// at the limits of the format.
+#include <unity.h>
+#include <string.h>
+
+#include "song_list.h"
+#include "song_packed.h"
+
+// The plain list under another name, as the reference for the packed one
+#undef SONG_BANK_PACKED
+#define SONG_BANK_PACKED 0
+#define all_songs plain_songs
+#define song_count plain_song_count
+#include "../../lib/arduino-songs/src/song_list.cpp"
+#undef all_songs
+#undef song_count
+
+// Same limits as tools/pack_songs.py
+#define MAX_MATCH 128
+#define MAX_DISTANCE 0xFFFF
+
+void setUp() {}
+void tearDown() {}
+
+static void test_every_song_round_trips() {
+  TEST_ASSERT_EQUAL_UINT(plain_song_count, song_count);
+
+  for (unsigned int i = 0; i < song_count; i++) {
+    const Song &packed = *all_songs[i];
+    const Song &plain = *plain_songs[i];
+    TEST_ASSERT_NOT_NULL_MESSAGE(packed.packed, plain.name);
+    TEST_ASSERT_EQUAL_STRING(plain.name, packed.name);
+    TEST_ASSERT_EQUAL_UINT_MESSAGE(plain.length, packed.length, plain.name);
+    TEST_ASSERT_EQUAL_UINT_MESSAGE(plain.tempo, packed.tempo, plain.name);
+
+    SongCursor cursor;
+    songCursorBegin(cursor, packed);
+    for (unsigned int note = 0; note < plain.length; note++) {
+      int frequency, divider;
+      TEST_ASSERT_TRUE_MESSAGE(songCursorNext(cursor, frequency, divider), plain.name);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(plain.melody[note * 2], frequency, plain.name);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(plain.melody[note * 2 + 1], divider, plain.name);
+    }
+    int frequency, divider;
+    TEST_ASSERT_FALSE_MESSAGE(songCursorNext(cursor, frequency, divider), plain.name);
+
+    TEST_ASSERT_EQUAL_MESSAGE(plain.tracks == nullptr, packed.tracks == nullptr, plain.name);
+    if (plain.tracks == nullptr)
+      continue;
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(plain.tracks->voices, packed.tracks->voices, plain.name);
+    for (unsigned int note = 0; note < plain.length; note++) {
+      for (uint8_t voice = 0; voice < plain.tracks->voices; voice++) {
+        TEST_ASSERT_EQUAL_UINT16_MESSAGE(songTrackPitch(plain, note, voice),
+                                         songTrackPitch(packed, note, voice), plain.name);
+        TEST_ASSERT_EQUAL_MESSAGE(songTrackTied(plain, note, voice),
+                                  songTrackTied(packed, note, voice), plain.name);
+      }
+    }
+  }
+}
+
+// Starting mid-song, the resume path, lands on the same notes
+static void test_cursor_begin_skips_into_references() {
+  for (unsigned int i = 0; i < song_count; i++) {
+    const Song &packed = *all_songs[i];
+    const Song &plain = *plain_songs[i];
+    for (unsigned int start = 0; start < plain.length; start += 7) {
+      SongCursor cursor;
+      songCursorBegin(cursor, packed, start);
+      int frequency, divider;
+      TEST_ASSERT_TRUE_MESSAGE(songCursorNext(cursor, frequency, divider), plain.name);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(plain.melody[start * 2], frequency, plain.name);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(plain.melody[start * 2 + 1], divider, plain.name);
+    }
+  }
+}
+
+static void expectNote(SongCursor &cursor, uint8_t code, int8_t divider) {
+  int frequency, gotDivider;
+  TEST_ASSERT_TRUE(songCursorNext(cursor, frequency, gotDivider));
+  TEST_ASSERT_EQUAL_INT(song_pitch_table[code], frequency);
+  TEST_ASSERT_EQUAL_INT(divider, gotDivider);
+}
+
+static void expectEnd(SongCursor &cursor) {
+  int frequency, divider;
+  TEST_ASSERT_FALSE(songCursorNext(cursor, frequency, divider));
+}
+
+static void test_reference_to_offset_zero() {
+  static const uint8_t stream[] = {
+      10, 4,
+      20, (uint8_t)-8,
+      SONG_PACKED_REFERENCE | (2 - 1), 4, 0,
+  };
+  Song song = {"offset zero", nullptr, 4, 120, stream, nullptr};
+  SongCursor cursor;
+  songCursorBegin(cursor, song);
+  expectNote(cursor, 10, 4);
+  expectNote(cursor, 20, -8);
+  expectNote(cursor, 10, 4);
+  expectNote(cursor, 20, -8);
+  expectEnd(cursor);
+}
+
+static void test_longest_reference() {
+  static uint8_t stream[MAX_MATCH * 2 + 3];
+  for (uint8_t i = 0; i < MAX_MATCH; i++) {
+    stream[i * 2] = i % 64 + 1;
+    stream[i * 2 + 1] = (uint8_t)(i % 2 ? -i % 32 : i % 32);
+  }
+  uint16_t at = MAX_MATCH * 2;
+  stream[at] = SONG_PACKED_REFERENCE | (MAX_MATCH - 1);
+  stream[at + 1] = at & 0xFF;
+  stream[at + 2] = at >> 8;
+
+  Song song = {"longest", nullptr, MAX_MATCH * 2, 120, stream, nullptr};
+  SongCursor cursor;
+  songCursorBegin(cursor, song);
+  for (uint8_t pass = 0; pass < 2; pass++)
+    for (uint8_t i = 0; i < MAX_MATCH; i++)
+      expectNote(cursor, stream[i * 2], (int8_t)stream[i * 2 + 1]);
+  expectEnd(cursor);
+}
+
+static void test_farthest_reference() {
+  // A 1-note reference brings the farthest one to an odd offset, the
+  // literals fill up to it
+  static uint8_t stream[MAX_DISTANCE + 3];
+  stream[0] = 30;
+  stream[1] = 2;
+  stream[2] = SONG_PACKED_REFERENCE;
+  stream[3] = 2;
+  stream[4] = 0;
+  unsigned int notes = 2;
+  uint32_t at = 5;
+  for (; at < MAX_DISTANCE; at += 2, notes++) {
+    stream[at] = 40 + notes % 16;
+    stream[at + 1] = 8;
+  }
+  TEST_ASSERT_EQUAL_UINT32(MAX_DISTANCE, at);
+  stream[at] = SONG_PACKED_REFERENCE;
+  stream[at + 1] = MAX_DISTANCE & 0xFF;
+  stream[at + 2] = MAX_DISTANCE >> 8;
+  notes++;
+
+  Song song = {"farthest", nullptr, notes, 120, stream, nullptr};
+  SongCursor cursor;
+  songCursorBegin(cursor, song, notes - 1);
+  expectNote(cursor, 30, 2);
+  expectEnd(cursor);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_song_round_trips);
+  RUN_TEST(test_cursor_begin_skips_into_references);
+  RUN_TEST(test_reference_to_offset_zero);
+  RUN_TEST(test_longest_reference);
+  RUN_TEST(test_farthest_reference);
+  return UNITY_END();
+}
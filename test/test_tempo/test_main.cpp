@@ -0,0 +1,126 @@
+// Host tests for the score/real time conversions: pio test -e native
+#include <unity.h>
+
+// The firmware ships with ramps off; the ramp tests need one
+#define TEMPO_RAMP_MS 400
+#include "tempo.h"
+
+#define SPEED_COUNT (sizeof(SPEED_SETTINGS_PERMILLE) / sizeof(SPEED_SETTINGS_PERMILLE[0]))
+
+void setUp() {}
+void tearDown() {}
+
+// Single notes up to whole songs, 10 minutes still fits 32 bits at 0.25x
+static const uint32_t SCORE_US[] = {
+    0, 1, 249, 250, 999, 1000, 1001, 2999, 3000, 3001,
+    56250, 112500, 337500, 1234567, 60000000, 600000000,
+};
+
+static void test_known_values() {
+  TEST_ASSERT_EQUAL_UINT32(4000000, scoreToRealUs(1000000, 250));
+  TEST_ASSERT_EQUAL_UINT32(2000000, scoreToRealUs(1000000, 500));
+  TEST_ASSERT_EQUAL_UINT32(1000000, scoreToRealUs(1000000, 1000));
+  TEST_ASSERT_EQUAL_UINT32(666666, scoreToRealUs(1000000, 1500));
+  TEST_ASSERT_EQUAL_UINT32(500000, scoreToRealUs(1000000, 2000));
+  TEST_ASSERT_EQUAL_UINT32(333333, scoreToRealUs(1000000, 3000));
+  TEST_ASSERT_EQUAL_UINT32(250000, realToScoreUs(1000000, 250));
+  TEST_ASSERT_EQUAL_UINT32(3000000, realToScoreUs(1000000, 3000));
+}
+
+// Both directions truncate, so a round trip loses less than one real
+// microsecond's worth of score time
+static void test_round_trips_at_every_speed() {
+  for (uint8_t s = 0; s < SPEED_COUNT; s++) {
+    uint16_t speed = SPEED_SETTINGS_PERMILLE[s];
+    uint32_t tolerance = (speed + 999) / 1000;
+    for (uint32_t scoreUs : SCORE_US) {
+      uint32_t realUs = scoreToRealUs(scoreUs, speed);
+      TEST_ASSERT_EQUAL_UINT32((uint64_t)scoreUs * 1000 / speed, realUs);
+      uint32_t backUs = realToScoreUs(realUs, speed);
+      TEST_ASSERT_TRUE(backUs <= scoreUs);
+      TEST_ASSERT_UINT32_WITHIN(tolerance, scoreUs, backUs);
+    }
+  }
+}
+
+static void test_jump_holds_the_speed() {
+  TempoRamp ramp;
+  for (uint8_t s = 0; s < SPEED_COUNT; s++) {
+    ramp.jump(SPEED_SETTINGS_PERMILLE[s]);
+    TEST_ASSERT_FALSE(ramp.active(0));
+    TEST_ASSERT_EQUAL_UINT16(SPEED_SETTINGS_PERMILLE[s], ramp.at(0));
+    TEST_ASSERT_EQUAL_UINT16(SPEED_SETTINGS_PERMILLE[s], ramp.at(123456789));
+  }
+}
+
+static void checkEndpoints(uint16_t from, uint16_t to, uint32_t startUs) {
+  TempoRamp ramp;
+  ramp.jump(from);
+  ramp.glide(to, startUs);
+
+  TEST_ASSERT_EQUAL_UINT16(from, ramp.at(startUs));
+  TEST_ASSERT_EQUAL_UINT16(from + ((int32_t)to - from) / 2, ramp.at(startUs + TEMPO_RAMP_MS * 500));
+  TEST_ASSERT_EQUAL_UINT16(to, ramp.at(startUs + TEMPO_RAMP_MS * 1000));
+  TEST_ASSERT_EQUAL_UINT16(to, ramp.at(startUs + TEMPO_RAMP_MS * 1000 + 1000000));
+  TEST_ASSERT_EQUAL(from != to, ramp.active(startUs));
+  TEST_ASSERT_EQUAL(from != to, ramp.active(startUs + TEMPO_RAMP_MS * 1000 - 1000));
+  TEST_ASSERT_FALSE(ramp.active(startUs + TEMPO_RAMP_MS * 1000));
+
+  // Never outside the two settings on the way
+  uint16_t low = from < to ? from : to;
+  uint16_t high = from < to ? to : from;
+  for (uint32_t ms = 0; ms <= TEMPO_RAMP_MS; ms++) {
+    uint16_t speed = ramp.at(startUs + ms * 1000);
+    TEST_ASSERT_TRUE(speed >= low && speed <= high);
+  }
+}
+
+static void test_ramp_endpoints() {
+  for (uint8_t a = 0; a < SPEED_COUNT; a++)
+    for (uint8_t b = 0; b < SPEED_COUNT; b++)
+      checkEndpoints(SPEED_SETTINGS_PERMILLE[a], SPEED_SETTINGS_PERMILLE[b], 5000000);
+}
+
+// micros() wraps after ~71 minutes
+static void test_ramp_across_micros_wrap() {
+  checkEndpoints(1000, 3000, 0xFFFFFFFF - TEMPO_RAMP_MS * 500);
+  checkEndpoints(3000, 250, 0xFFFFFFFF - 1);
+}
+
+// A new speed mid-ramp starts from where the ramp got to
+static void test_glide_mid_ramp_is_continuous() {
+  TempoRamp ramp;
+  ramp.jump(1000);
+  ramp.glide(3000, 0);
+  uint32_t midUs = TEMPO_RAMP_MS * 250;
+  uint16_t reached = ramp.at(midUs);
+  ramp.glide(500, midUs);
+  TEST_ASSERT_EQUAL_UINT16(reached, ramp.at(midUs));
+  TEST_ASSERT_EQUAL_UINT16(500, ramp.at(midUs + TEMPO_RAMP_MS * 1000));
+}
+
+// The player's trapezoid sum over 20 ms loop periods, against the exact
+// score time of a linear ramp from 1.0x to 2.0x: 1.5x over the ramp
+static void test_playback_sum_over_a_ramp() {
+  TempoRamp ramp;
+  ramp.jump(1000);
+  ramp.glide(2000, 0);
+  uint32_t playedScoreUs = 0;
+  for (uint32_t lastUs = 0; lastUs < TEMPO_RAMP_MS * 1000; lastUs += 20000) {
+    uint32_t nowUs = lastUs + 20000;
+    playedScoreUs += realToScoreUs(nowUs - lastUs, (ramp.at(lastUs) + ramp.at(nowUs)) / 2);
+  }
+  TEST_ASSERT_UINT32_WITHIN(1000, TEMPO_RAMP_MS * 1500, playedScoreUs);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_known_values);
+  RUN_TEST(test_round_trips_at_every_speed);
+  RUN_TEST(test_jump_holds_the_speed);
+  RUN_TEST(test_ramp_endpoints);
+  RUN_TEST(test_ramp_across_micros_wrap);
+  RUN_TEST(test_glide_mid_ramp_is_continuous);
+  RUN_TEST(test_playback_sum_over_a_ramp);
+  return UNITY_END();
+}
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""Generates the compressed song list and the song table of contents.
+
+Runs as a PlatformIO pre-build script (see platformio.ini) and standalone:
+
+    python3 tools/pack_songs.py
+
+lib/arduino-songs/src/song_list_packed.cpp stores notes as 2-byte literals
+(pitch code, divider) instead of two ints. Repeated runs of notes become
+3-byte back-references to the earlier literals, which the player decodes in
+place with O(1) RAM (see song_packed.h). Track rows shrink from ints to
+1-byte pitch codes. The per-song .rodata of both builds is printed on every
+run.
+
+lib/arduino-songs/include/song_toc.h and src/song_toc.cpp hold per-song
+metadata, so the firmware never has to walk a melody to get it.
+"""
+
+import os
+import sys
+
+MIN_MATCH = 2   # a reference costs 3 bytes, two literal notes 4
+MAX_MATCH = 128
+MAX_DISTANCE = 0xFFFF
+TARGET_INT_SIZE = 4  # Song::melody and SongTracks::rows are int arrays
+
+OUTPUT = os.path.join("lib", "arduino-songs", "src", "song_list_packed.cpp")
+TOC_HEADER = os.path.join("lib", "arduino-songs", "include", "song_toc.h")
+TOC_SOURCE = os.path.join("lib", "arduino-songs", "src", "song_toc.cpp")
+
+# Lower edges of the visualizer bands, the last entry closes the top band
+BAND_BOUNDARIES = [
+    (31, "NOTE_B0"), (65, "NOTE_C2"), (98, "NOTE_G2"), (131, "NOTE_C3"),
+    (165, "NOTE_E3"), (196, "NOTE_G3"), (247, "NOTE_B3"), (294, "NOTE_D4"),
+    (349, "NOTE_F4"), (415, "NOTE_GS4"), (494, "NOTE_B4"), (587, "NOTE_D5"),
+    (698, "NOTE_F5"), (831, "NOTE_GS5"), (988, "NOTE_B5"), (1319, "NOTE_E6"),
+    (4978, "NOTE_DS8"),
+]
+
+
+def compress(notes):
+    """Greedy LZ over (code, divider) pairs.
+
+    A reference may only point at a run that was emitted as literals, so the
+    decoder never has to follow a reference from inside another one.
+    """
+    out = bytearray()
+    literal_at = [None] * len(notes)
+    i = 0
+    while i < len(notes):
+        best_length, best_start = 0, None
+        for j in range(i):
+            if literal_at[j] is None or len(out) - literal_at[j] > MAX_DISTANCE:
+                continue
+            length = 0
+            while (i + length < len(notes) and j + length < i and length < MAX_MATCH
+                   and literal_at[j + length] is not None and notes[j + length] == notes[i + length]):
+                length += 1
+            if length > best_length:
+                best_length, best_start = length, j
+
+        if best_length >= MIN_MATCH:
+            distance = len(out) - literal_at[best_start]
+            out += bytes([0x80 | (best_length - 1), distance & 0xFF, distance >> 8])
+            i += best_length
+        else:
+            literal_at[i] = len(out)
+            out += bytes([notes[i][0], notes[i][1] & 0xFF])
+            i += 1
+    return bytes(out)
+
+
+def decompress(data, count):
+    """Mirror of songCursorNext(), used to check every song before writing."""
+    notes, pos = [], 0
+    while len(notes) < count:
+        if data[pos] & 0x80:
+            length = (data[pos] & 0x7F) + 1
+            ref = pos - (data[pos + 1] | (data[pos + 2] << 8))
+            for k in range(length):
+                notes.append((data[ref + 2 * k], data[ref + 2 * k + 1]))
+            pos += 3
+        else:
+            notes.append((data[pos], data[pos + 1]))
+            pos += 2
+    return notes
+
+
+def band_of(frequency):
+    """noteToBar() from src/main.cpp."""
+    for band in range(len(BAND_BOUNDARIES) - 1):
+        if BAND_BOUNDARIES[band][0] <= frequency < BAND_BOUNDARIES[band + 1][0]:
+            return band
+    return len(BAND_BOUNDARIES) - 2
+
+
+def song_info(name, tempo, values):
+    from songsource import f32, note_duration_ms
+
+    notes = [(values[k], values[k + 1]) for k in range(0, len(values), 2)]
+    duration = 0.0
+    for _, divider in notes:
+        duration = f32(duration + note_duration_ms(divider, tempo))
+    pitches = [frequency for frequency, _ in notes if frequency]
+    band_mask = 0
+    for frequency in pitches:
+        band_mask |= 1 << band_of(frequency)
+    return {
+        "name": name,
+        "duration": int(duration),
+        "length": len(notes),
+        "lowest": min(pitches, default=0),
+        "highest": max(pitches, default=0),
+        "bands": band_mask,
+    }
+
+
+def write_if_changed(path, text):
+    if not os.path.exists(path) or open(path).read() != text:
+        with open(path, "w") as f:
+            f.write(text)
+
+
+def generate_toc(project_dir, infos):
+    bands = len(BAND_BOUNDARIES) - 1
+    header = [
+        "// Generated by tools/pack_songs.py from the song sources, do not edit.",
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+        "// Per-song metadata, in all_songs[] order",
+        "struct SongInfo {",
+        "    uint32_t durationMs;        // at 1.0x",
+        "    uint16_t length;            // notes",
+        "    uint16_t lowestFrequency;   // rests excluded",
+        "    uint16_t highestFrequency;",
+        "    uint16_t bandMask;          // visualizer bands the song reaches",
+        "};",
+        "",
+        "// Longest melody, the most notes any per-song buffer has to hold",
+        "#define SONG_TOC_MAX_LENGTH %d" % max(info["length"] for info in infos),
+        "#define SONG_TOC_BANDS %d" % bands,
+        "",
+        "extern const SongInfo song_toc[];",
+        "// Lower band edges in Hz, the last entry closes the top band",
+        "extern const uint16_t song_band_boundaries[SONG_TOC_BANDS + 1];",
+        "",
+    ]
+    source = [
+        "// Generated by tools/pack_songs.py from the song sources, do not edit.",
+        '#include "song_toc.h"',
+        "",
+        "const SongInfo song_toc[] = {",
+    ]
+    for info in infos:
+        source.append("    {%(duration)d, %(length)d, %(lowest)d, %(highest)d, 0x%(bands)04X}, // %(name)s" % info)
+    source += [
+        "};",
+        "",
+        "const uint16_t song_band_boundaries[SONG_TOC_BANDS + 1] = {",
+    ]
+    for frequency, name in BAND_BOUNDARIES:
+        source.append("    %d, // %s" % (frequency, name))
+    source += ["};", ""]
+
+    write_if_changed(os.path.join(project_dir, TOC_HEADER), "\n".join(header))
+    write_if_changed(os.path.join(project_dir, TOC_SOURCE), "\n".join(source))
+
+
+def generate(project_dir):
+    sys.path.insert(0, os.path.join(project_dir, "tools"))
+    from songsource import load_pitches, parse_song, parse_tracks, song_list
+
+    # Pitch codes are indices into song_pitch_table[], which lists pitches.h
+    # in definition order
+    pitch_codes = {freq: code for code, freq in enumerate(load_pitches().values())}
+
+    lines = [
+        "// Generated by tools/pack_songs.py from the song sources, do not edit.",
+        "#if SONG_BANK_PACKED",
+        '#include "song_list.h"',
+        "",
+    ]
+    table = []
+    infos = []
+    total_raw = total_packed = 0
+
+    for path in song_list():
+        ident = os.path.splitext(os.path.basename(path))[0]
+        name, tempo, values = parse_song(path)
+        infos.append(song_info(name, tempo, values))
+        notes = [(pitch_codes[values[k]], values[k + 1]) for k in range(0, len(values), 2)]
+        packed = compress(notes)
+        assert decompress(packed, len(notes)) == [(c, d & 0xFF) for c, d in notes], name
+        assert len(packed) <= 0x10000, name  # SongCursor positions are 16-bit
+
+        tracks = parse_tracks(path)
+        row_count = 0 if tracks is None else len(tracks[1])
+        # The arrays each build puts in .rodata for this song; the Song and
+        # SongTracks structs and the name are the same in both
+        raw = (len(values) + row_count) * TARGET_INT_SIZE
+        packed_size = len(packed) + row_count
+        total_raw += raw
+        total_packed += packed_size
+        table.append((name, len(notes), row_count, raw, packed_size))
+
+        lines.append("// %s: %d notes, %d -> %d bytes" % (name, len(notes), len(values) * TARGET_INT_SIZE,
+                                                        len(packed)))
+        lines.append("static const uint8_t %s_packed[] = {" % ident)
+        for k in range(0, len(packed), 16):
+            lines.append("    " + ", ".join("0x%02X" % b for b in packed[k:k + 16]) + ",")
+        lines.append("};")
+        if tracks is None:
+            lines.append('static const Song %s_packed_song = {"%s", nullptr, %d, %d, %s_packed};'
+                         % (ident, name, len(notes), tempo, ident))
+        else:
+            # One pitch code per voice and note, ties as SONG_PACKED_TIE
+            voices, rows = tracks
+            assert len(rows) == voices * len(notes), name
+            codes = [0xFF if value == -1 else pitch_codes[value] for value in rows]
+            lines.append("static const uint8_t %s_rows[] = {" % ident)
+            for k in range(0, len(codes), 16):
+                lines.append("    " + ", ".join("0x%02X" % b for b in codes[k:k + 16]) + ",")
+            lines.append("};")
+            lines.append("static const SongTracks %s_tracks = {%d, nullptr, %s_rows};" % (ident, voices, ident))
+            lines.append('static const Song %s_packed_song = {"%s", nullptr, %d, %d, %s_packed, &%s_tracks};'
+                         % (ident, name, len(notes), tempo, ident, ident))
+        lines.append("")
+
+    lines.append("const Song* all_songs[] = {")
+    for path in song_list():
+        lines.append("    &%s_packed_song," % os.path.splitext(os.path.basename(path))[0])
+    lines.append("};")
+    lines.append("")
+    lines.append("const unsigned int song_count = sizeof(all_songs) / sizeof(all_songs[0]);")
+    lines.append("#endif")
+    lines.append("")
+
+    # .rodata of the song data with SONG_BANK_PACKED=0 (plain) and =1, track
+    # rows included. song_pitch_table[] is linked into both builds.
+    print("%-24s %6s %6s %7s %7s %6s" % ("song", "notes", "rows", "plain", "packed", "saved"))
+    for name, count, row_count, raw, packed in table:
+        print("%-24s %6d %6d %7d %7d %5.1f%%" % (name, count, row_count, raw, packed,
+                                                 100.0 * (raw - packed) / raw))
+    print("%-24s %6s %6s %7d %7d %5.1f%%" % ("total", "", "", total_raw, total_packed,
+                                               100.0 * (total_raw - total_packed) / total_raw))
+    print(".rodata %d -> %d bytes, %d saved" % (total_raw, total_packed, total_raw - total_packed))
+
+    write_if_changed(os.path.join(project_dir, OUTPUT), "\n".join(lines))
+    generate_toc(project_dir, infos)
+
+
+try:
+    Import("env")  # noqa: F821, defined when run by PlatformIO
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
@@ -0,0 +1,409 @@
+// Host run of the firmware's note loop (src/player.h, which playSong() in
+// src/main.cpp drives) on a virtual clock: the same score time, tempo ramp,
+// note schedule, buzzer retiming and song gap, with the rest of the loop
+// modelled as fixed costs. It records into the same PlaybackTrace as the
+// firmware's TRACE mode and prints the same text, for tools/tracecmp.py.
+//
+//   g++ -std=c++17 -O2 -pthread -DSONG_BANK_PACKED=1 -DTRACE_CAPACITY=2048
+//       -Isrc -Ilib/arduino-songs/include -Ilib/PlaybackTrace/include
+//       tools/playsim.cpp lib/arduino-songs/src/*.cpp
+//       lib/PlaybackTrace/src/PlaybackTrace.cpp -o playsim
+//
+// SONG_BANK_PACKED=1 decodes the packed songs, as the firmware does; add
+// -DTEMPO_RAMP_MS=400 for speed changes that glide.
+//
+//   ./playsim > trace.txt                  trace of every song at every speed
+//   ./playsim --render out/                8-bit PCM WAV per song, buzzer simulated
+//   ./playsim --golden tools/golden.trace  diff timing against the stored traces
+//   ./playsim --update tools/golden.trace  rewrite them after an intended change
+//
+// Options: --song N, --speed IDX|all (default all), --jobs N (default all
+// cores), --rate HZ (WAV sample rate), --frame-us US, --idle-ms MS,
+// --flick NOTE:STEPS (a speed flick while NOTE plays). Each song starts
+// SONG_GAP_MS after the previous one's scheduled end, and its successor is
+// prefetched SONG_PREFETCH_MS before its own. The WAV has the melody only.
+// Songs are simulated in parallel; throughput goes to stderr.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "PlaybackTrace.h"
+#include "player.h"
+#include "song_toc.h"
+
+// Time the firmware spends outside the note loop's timing, per event
+struct Model {
+  uint32_t cursorUs = 40;      // pause check, cursor and ramp math before the onset
+  uint32_t noteStartUs = 150;  // buzzer start and journal after the onset
+  uint32_t frameUs = 2000;     // visualizer, drawUI() and the input checks
+  uint32_t idleMs = PLAYER_IDLE_MS; // loopIdle() at the end of each pass
+  uint32_t prefetchUs = 300;   // prepareSong() for the next song
+  uint32_t gapPollUs = 50;     // bus and serial work between songs
+  int flickNote = -1;
+  int flickSteps = 0;
+};
+
+struct Job {
+  unsigned int song;
+  int speedIdx;
+  std::unique_ptr<PlaybackTrace> trace;
+  std::string text;
+  unsigned int notes = 0;
+  size_t wavBytes = 0;
+};
+
+static double speedOf(const Job &job) {
+  return SPEED_SETTINGS_PERMILLE[job.speedIdx] / 1000.0;
+}
+
+// The firmware's FirmwareBoard with a virtual clock and a simulated buzzer:
+// a note sounds from its onset for its whole milliseconds, or until
+// setRemaining() moves its end
+class SimBoard {
+public:
+  SimBoard(Job &job, const Model &model, NotePlayer &player)
+      : _job(job), _model(model), _player(player), _trace(*job.trace) {
+    songCursorBegin(_cursor, *all_songs[job.song]);
+  }
+
+  uint32_t nowUs = 0;
+
+  uint32_t micros() { return nowUs; }
+  void noteDue(unsigned int noteIdx) { _noteIdx = noteIdx; }
+
+  bool nextNote(int &frequency, int &divider) {
+    nowUs += _model.cursorUs;
+    return songCursorNext(_cursor, frequency, divider);
+  }
+
+  int pauseOrSkip() { return 0; }
+
+  int speedChange() {
+    if (_flicked || (int)_noteIdx != _model.flickNote)
+      return 0;
+    _flicked = true;
+    return _model.flickSteps;
+  }
+
+  void noteStarting(unsigned int noteIdx, int frequency, uint32_t, uint32_t onsetUs, uint32_t durationMs) {
+    _trace.start(onsetUs, noteIdx, frequency);
+    _trace.stop(onsetUs + durationMs * 1000, noteIdx);
+  }
+
+  void startNote(unsigned int, bool, int, uint32_t) {
+    nowUs += _model.noteStartUs;
+    _job.notes++;
+  }
+
+  void speedChanged(unsigned int noteIdx) { _trace.anchor(nowUs, noteIdx + 1, _player.speed()); }
+  void setRemaining(unsigned int noteIdx, uint32_t, uint32_t stopUs) { _trace.stop(stopUs, noteIdx); }
+
+  void notePlaying(int) {
+    nowUs += _model.frameUs;
+    if (!_prefetched && _player.prefetchDue(song_toc[_job.song].durationMs)) {
+      nowUs += _model.prefetchUs;
+      _prefetched = true;
+    }
+  }
+
+  void idle(uint32_t) { nowUs += _model.idleMs * 1000; }
+  void gapPassing() { nowUs += _model.gapPollUs; }
+
+private:
+  Job &_job;
+  const Model &_model;
+  NotePlayer &_player;
+  PlaybackTrace &_trace;
+  SongCursor _cursor;
+  unsigned int _noteIdx = 0;
+  bool _flicked = false;
+  bool _prefetched = false;
+};
+
+static thread_local std::string *dumpTarget;
+
+static void appendLine(const char *line) {
+  dumpTarget->append(line);
+  dumpTarget->push_back('\n');
+}
+
+// As setup() plays a song that follows another: the previous one's last
+// note was scheduled to end at 0, then the gap, then playSong()
+static void playSong(Job &job, const Model &model) {
+  const Song &song = *all_songs[job.song];
+  NotePlayer player;
+  SimBoard board(job, model, player);
+  player.scheduleUs = 0;
+  player.scheduleValid = true;
+  player.waitForGap(board);
+
+  player.positionMs = 0;
+  player.speedSettingIdx = job.speedIdx;
+  job.trace->song(board.micros(), job.song, player.speed());
+  player.play(board, 0, song.length, song.tempo);
+
+  dumpTarget = &job.text;
+  job.trace->dump(appendLine);
+}
+
+static void putU16(FILE *file, uint16_t value) {
+  fputc(value & 0xFF, file);
+  fputc(value >> 8, file);
+}
+
+static void putU32(FILE *file, uint32_t value) {
+  putU16(file, value & 0xFFFF);
+  putU16(file, value >> 16);
+}
+
+// The buzzer is a 50% square wave while a tone is on, silence otherwise
+static bool renderWav(Job &job, const char *dir, uint32_t rate) {
+  const PlaybackTrace &trace = *job.trace;
+  if (trace.overwritten()) {
+    fprintf(stderr, "song %u: trace ring too small, build with a larger TRACE_CAPACITY\n", job.song);
+    return false;
+  }
+
+  uint32_t endUs = 0;
+  for (size_t i = 0; i < trace.count(); i++)
+    endUs = std::max(endUs, trace.at(i).timeUs);
+  uint32_t samples = (uint64_t)endUs * rate / 1000000;
+
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%02u_%s_%.2fx.wav", dir, job.song, all_songs[job.song]->name, speedOf(job));
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return false;
+  }
+
+  fwrite("RIFF", 1, 4, file);
+  putU32(file, 36 + samples);
+  fwrite("WAVEfmt ", 1, 8, file);
+  putU32(file, 16);
+  putU16(file, 1); // PCM
+  putU16(file, 1); // mono
+  putU32(file, rate);
+  putU32(file, rate);
+  putU16(file, 1);
+  putU16(file, 8);
+  fwrite("data", 1, 4, file);
+  putU32(file, samples);
+
+  std::vector<uint8_t> pcm(samples, 128);
+  uint16_t frequency = 0;
+  double phase = 0;
+  size_t next = 0;
+  for (uint32_t n = 0; n < samples; n++) {
+    uint64_t timeUs = (uint64_t)n * 1000000 / rate;
+    while (next < trace.count() && trace.at(next).timeUs <= timeUs) {
+      const TraceEvent &event = trace.at(next++);
+      if (event.kind == TRACE_START)
+        frequency = event.value;
+      else if (event.kind == TRACE_STOP)
+        frequency = 0;
+    }
+    if (frequency) {
+      phase += (double)frequency / rate;
+      phase -= (int)phase;
+      pcm[n] = phase < 0.5 ? 192 : 64;
+    }
+  }
+  fwrite(pcm.data(), 1, pcm.size(), file);
+  fclose(file);
+  job.wavBytes = 44 + samples;
+  return true;
+}
+
+static std::string readFile(const char *path) {
+  std::string text;
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr)
+    return text;
+  char buffer[4096];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    text.append(buffer, length);
+  fclose(file);
+  return text;
+}
+
+static std::vector<std::string> splitLines(const std::string &text) {
+  std::vector<std::string> lines;
+  size_t start = 0;
+  while (start < text.size()) {
+    size_t end = text.find('\n', start);
+    if (end == std::string::npos)
+      end = text.size();
+    lines.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+  return lines;
+}
+
+// Golden traces are the concatenated per-song text, in job order
+static int diffGolden(const std::vector<Job> &jobs, const char *path) {
+  std::string golden = readFile(path);
+  if (golden.empty()) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+
+  // Cut the golden file into songs on their "song" lines
+  std::vector<std::string> expected;
+  for (const std::string &line : splitLines(golden)) {
+    if (line.compare(0, 5, "song ") == 0)
+      expected.emplace_back();
+    if (!expected.empty())
+      expected.back() += line + "\n";
+  }
+
+  int changed = 0;
+  for (size_t j = 0; j < jobs.size(); j++) {
+    const Job &job = jobs[j];
+    const Song &song = *all_songs[job.song];
+    if (j >= expected.size()) {
+      printf("%-24s %.2fx: not in golden traces\n", song.name, speedOf(job));
+      changed++;
+      continue;
+    }
+
+    std::vector<std::string> want = splitLines(expected[j]);
+    std::vector<std::string> got = splitLines(job.text);
+    size_t differing = 0;
+    long worstUs = 0;
+    for (size_t i = 0; i < std::max(want.size(), got.size()); i++) {
+      if (i >= want.size() || i >= got.size()) {
+        differing++;
+        continue;
+      }
+      if (want[i] == got[i])
+        continue;
+      differing++;
+      char wantKind[16], gotKind[16];
+      unsigned long wantUs, gotUs;
+      if (sscanf(want[i].c_str(), "%15s %lu", wantKind, &wantUs) == 2 &&
+          sscanf(got[i].c_str(), "%15s %lu", gotKind, &gotUs) == 2 && strcmp(wantKind, gotKind) == 0 &&
+          labs((long)gotUs - (long)wantUs) > labs(worstUs))
+        worstUs = (long)gotUs - (long)wantUs;
+    }
+    if (differing) {
+      printf("%-24s %.2fx: %zu of %zu lines differ, worst shift %+.3f ms\n", song.name,
+             speedOf(job), differing, want.size(), worstUs / 1000.0);
+      changed++;
+    }
+  }
+  if (expected.size() > jobs.size())
+    printf("%zu golden traces have no song here\n", expected.size() - jobs.size());
+
+  printf("%zu traces, %d changed\n", jobs.size(), changed);
+  return changed ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  Model model;
+  int onlySong = -1;
+  int onlySpeed = -1;
+  unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+  uint32_t rate = 22050;
+  const char *renderDir = nullptr;
+  const char *goldenPath = nullptr;
+  bool update = false;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--song") == 0)
+      onlySong = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--speed") == 0)
+      onlySpeed = strcmp(argv[i + 1], "all") == 0 ? -1 : atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--jobs") == 0)
+      threads = std::max(1, atoi(argv[i + 1]));
+    else if (strcmp(argv[i], "--rate") == 0)
+      rate = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--render") == 0)
+      renderDir = argv[i + 1];
+    else if (strcmp(argv[i], "--golden") == 0)
+      goldenPath = argv[i + 1];
+    else if (strcmp(argv[i], "--update") == 0)
+      goldenPath = argv[i + 1], update = true;
+    else if (strcmp(argv[i], "--frame-us") == 0)
+      model.frameUs = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--idle-ms") == 0)
+      model.idleMs = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--flick") == 0)
+      sscanf(argv[i + 1], "%d:%d", &model.flickNote, &model.flickSteps);
+    else {
+      fprintf(stderr, "unknown option %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  std::vector<Job> jobs;
+  for (unsigned int song = 0; song < song_count; song++) {
+    if (onlySong >= 0 && (unsigned int)onlySong != song)
+      continue;
+    for (int speedIdx = 0; speedIdx <= SPEED_SETTINGS_MAX_IDX; speedIdx++) {
+      if (onlySpeed >= 0 && onlySpeed != speedIdx)
+        continue;
+      Job job;
+      job.song = song;
+      job.speedIdx = speedIdx;
+      job.trace.reset(new PlaybackTrace());
+      jobs.push_back(std::move(job));
+    }
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  std::atomic<size_t> nextJob(0);
+  std::atomic<int> failures(0);
+  std::vector<std::thread> workers;
+  for (unsigned int t = 0; t < std::min<size_t>(threads, jobs.size()); t++) {
+    workers.emplace_back([&]() {
+      for (size_t j; (j = nextJob++) < jobs.size();) {
+        playSong(jobs[j], model);
+        if (renderDir && !renderWav(jobs[j], renderDir, rate))
+          failures++;
+      }
+    });
+  }
+  for (std::thread &worker : workers)
+    worker.join();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  unsigned long notes = 0;
+  size_t wavBytes = 0;
+  for (const Job &job : jobs) {
+    notes += job.notes;
+    wavBytes += job.wavBytes;
+  }
+  fprintf(stderr, "%zu songs, %lu notes in %.3f s on %u threads: %.0f notes/s", jobs.size(), notes,
+          seconds, threads, notes / std::max(seconds, 1e-9));
+  if (renderDir)
+    fprintf(stderr, ", %.1f MB of WAV", wavBytes / 1e6);
+  fprintf(stderr, "\n");
+
+  std::string all;
+  for (const Job &job : jobs)
+    all += job.text;
+
+  if (goldenPath && !update)
+    return diffGolden(jobs, goldenPath) || failures;
+
+  FILE *out = goldenPath ? fopen(goldenPath, "w") : (renderDir ? nullptr : stdout);
+  if (goldenPath && out == nullptr) {
+    fprintf(stderr, "cannot write %s\n", goldenPath);
+    return 1;
+  }
+  if (out) {
+    fwrite(all.data(), 1, all.size(), out);
+    if (out != stdout)
+      fclose(out);
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+// Packs the built-in song list into an external flash image, and streams an
+// image back through SongStream/FileStorage to check it against the sources.
+//
+//   g++ -std=c++17 -O2 -Isrc -Ilib/arduino-songs/include -Ilib/SongStream/include
+//       tools/songbank.cpp lib/arduino-songs/src/*.cpp lib/SongStream/src/SongStream.cpp
+//       -o songbank
+//   ./songbank pack songs.bin
+//   ./songbank verify songs.bin [read delay us]
+//
+// The image can be written to the SPI flash with any programmer at offset 0.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "SongStream.h"
+#include "note.h"
+
+static void putU16(std::vector<uint8_t> &out, uint16_t value) {
+  out.push_back(value & 0xFF);
+  out.push_back(value >> 8);
+}
+
+static void putU32(std::vector<uint8_t> &out, uint32_t value) {
+  putU16(out, value & 0xFFFF);
+  putU16(out, value >> 16);
+}
+
+static uint32_t songDurationMs(const Song &song) {
+  float total = 0;
+  SongCursor cursor;
+  int frequency, divider;
+  songCursorBegin(cursor, song);
+  while (songCursorNext(cursor, frequency, divider))
+    total += noteDuration(divider, song.tempo);
+  return (uint32_t)total;
+}
+
+static int pack(const char *path) {
+  std::vector<uint8_t> image;
+  putU32(image, SONG_BANK_MAGIC);
+  putU16(image, song_count);
+  putU16(image, SONG_BANK_ENTRY_SIZE);
+
+  uint32_t offset = SONG_BANK_HEADER_SIZE + song_count * SONG_BANK_ENTRY_SIZE;
+  for (unsigned int i = 0; i < song_count; i++) {
+    const Song &song = *all_songs[i];
+    putU32(image, offset);
+    putU32(image, songDurationMs(song));
+    putU16(image, song.length);
+    putU16(image, song.tempo);
+    char name[SONG_BANK_NAME_SIZE] = {};
+    strncpy(name, song.name, sizeof(name) - 1);
+    image.insert(image.end(), name, name + sizeof(name));
+    offset += song.length * SONG_BANK_NOTE_SIZE;
+  }
+
+  for (unsigned int i = 0; i < song_count; i++) {
+    SongCursor cursor;
+    int frequency, divider;
+    songCursorBegin(cursor, *all_songs[i]);
+    while (songCursorNext(cursor, frequency, divider)) {
+      putU16(image, (uint16_t)(int16_t)frequency);
+      putU16(image, (uint16_t)(int16_t)divider);
+    }
+  }
+
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr || fwrite(image.data(), 1, image.size(), file) != image.size()) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return 1;
+  }
+  fclose(file);
+  printf("%u songs, %zu bytes\n", song_count, image.size());
+  return 0;
+}
+
+static int verify(const char *path, unsigned readDelayUs) {
+  FileStorage storage(path, readDelayUs);
+  SongBank bank;
+  if (!bank.begin(storage)) {
+    fprintf(stderr, "%s is not a song bank image\n", path);
+    return 1;
+  }
+
+  int failures = 0;
+  unsigned totalNotes = 0;
+  uint32_t totalUnderruns = 0;
+  for (uint16_t i = 0; i < bank.count(); i++) {
+    SongStream stream;
+    if (!stream.open(bank, i)) {
+      fprintf(stderr, "song %u: cannot open\n", i);
+      failures++;
+      continue;
+    }
+
+    SongCursor cursor;
+    bool builtIn = i < song_count;
+    if (builtIn)
+      songCursorBegin(cursor, *all_songs[i]);
+    unsigned notes = 0;
+    int frequency, divider, expectedFrequency, expectedDivider;
+    // Mimics the player: one note popped per UI frame, read-ahead in between
+    while (stream.next(frequency, divider)) {
+      if (builtIn && (!songCursorNext(cursor, expectedFrequency, expectedDivider) ||
+                      frequency != expectedFrequency || divider != expectedDivider)) {
+        fprintf(stderr, "%s: note %u differs\n", stream.entry().name, notes);
+        failures++;
+        break;
+      }
+      notes++;
+      stream.fill();
+    }
+    if (notes != stream.entry().length) {
+      fprintf(stderr, "%s: %u of %u notes\n", stream.entry().name, notes, stream.entry().length);
+      failures++;
+    }
+    totalNotes += notes;
+    totalUnderruns += stream.underruns();
+  }
+
+  printf("%u songs, %u notes, %u storage reads, %u underruns, %d failures\n", bank.count(),
+         totalNotes, storage.reads(), totalUnderruns, failures);
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc >= 3 && strcmp(argv[1], "pack") == 0)
+    return pack(argv[2]);
+  if (argc >= 3 && strcmp(argv[1], "verify") == 0)
+    return verify(argv[2], argc >= 4 ? atoi(argv[3]) : 0);
+
+  fprintf(stderr, "usage: %s pack|verify <image> [read delay us]\n", argv[0]);
+  return 2;
+}
@@ -0,0 +1,87 @@
+"""Parses song sources in the lib/arduino-songs format."""
+
+import os
+import re
+import struct
+
+SONGS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "lib", "arduino-songs")
+PITCHES = os.path.join(SONGS_DIR, "include", "pitches.h")
+
+
+def load_pitches():
+    """Returns the pitches.h defines as an ordered {name: frequency} dict."""
+    pitches = {}
+    with open(PITCHES) as f:
+        for name, value in re.findall(r"#define\s+(\w+)\s+(\d+)", f.read()):
+            pitches[name] = int(value)
+    return pitches
+
+
+def parse_song(path):
+    """Returns (name, tempo, [frequency, divider, ...]) for one song source."""
+    source = open(path).read()
+    source = re.sub(r"//.*", "", source)
+    source = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+
+    melody = re.search(r"_melody\[\]\s*=\s*\{(.*?)\};", source, re.S).group(1)
+    song = re.search(r"Song\s+\w+\s*=\s*\{\s*\"(.*?)\".*?,.*?,.*?,\s*(\d+)\s*[,}]", source, re.S)
+
+    pitches = load_pitches()
+    values = []
+    for token in (t.strip() for t in melody.split(",")):
+        if token:
+            values.append(pitches[token] if token in pitches else int(token))
+    return song.group(1), int(song.group(2)), values
+
+
+def parse_tracks(path):
+    """Returns (voices, [frequency or -1 for a tie, ...]) for a song with
+    SongTracks, None for a melody alone."""
+    source = open(path).read()
+    source = re.sub(r"//.*", "", source)
+    source = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+
+    rows = re.search(r"_rows\[\]\s*=\s*\{(.*?)\};", source, re.S)
+    tracks = re.search(r"SongTracks\s+\w+\s*=\s*\{\s*(\d+)\s*,", source)
+    if rows is None or tracks is None:
+        return None
+
+    pitches = load_pitches()
+    pitches["SONG_TIE"] = -1
+    values = []
+    for token in (t.strip() for t in rows.group(1).split(",")):
+        if token:
+            values.append(pitches[token] if token in pitches else int(token))
+    return int(tracks.group(1)), values
+
+
+def song_list():
+    """Returns the song source paths in all_songs[] order."""
+    with open(os.path.join(SONGS_DIR, "src", "song_list.cpp")) as f:
+        names = re.findall(r"&(\w+)_song\b", f.read())
+    return [os.path.join(SONGS_DIR, "src", name + ".cpp") for name in names]
+
+
+def f32(value):
+    """Rounds to single precision, like the firmware's float math."""
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def note_duration_ms(divider, tempo):
+    # Same arithmetic as noteDuration() in src/note.h
+    wholenote = (60000 * 4) // tempo
+    if divider > 0:
+        duration = f32(wholenote / divider)
+    else:
+        duration = f32(f32(wholenote / abs(divider)) * 1.5)
+    return f32(duration * 0.9)
+
+
+def note_score_us(divider, tempo):
+    # (uint32_t)(noteDuration() * 1000), score time as src/player.h keeps it
+    return int(f32(note_duration_ms(divider, tempo) * 1000))
+
+
+def score_to_real_us(score_us, speed_permille):
+    # Same integer arithmetic as scoreToRealUs() in src/tempo.h
+    return score_us // speed_permille * 1000 + score_us % speed_permille * 1000 // speed_permille
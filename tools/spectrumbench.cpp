@@ -0,0 +1,211 @@
+// Host benchmark and check of the line-in analyzer's spectrum code
+// (lib/SpectrumAnalyzer/src/Spectrum.cpp) on synthetic ADC captures.
+//
+//   g++ -std=c++17 -O2 -Ilib/SpectrumAnalyzer/include -Ilib/arduino-songs/include
+//       tools/spectrumbench.cpp lib/SpectrumAnalyzer/src/Spectrum.cpp
+//       lib/arduino-songs/src/song_toc.cpp -o spectrumbench
+//
+//   ./spectrumbench              checks, then the frame rate check
+//   ./spectrumbench --frames N   frames for the timing run (default 20000)
+//   ./spectrumbench --frame-us U analysis time per frame to check instead of
+//                                the host's, e.g. the target's from the
+//                                cycles LineInAnalyzer::report() prints
+//
+// Checks: every band has bins of its own; a sine at the centre of every
+// visualizer band peaks in that band; two tones light their two bands;
+// silence stays dark; a full-scale sine reaches the top level. Exits 1 if
+// any check fails. Signals are held for a number of captures first, like
+// a steady input, so the DC bias estimate has settled.
+//
+// Frame rate: at least 30 frames a second, counted as if every frame took
+// a whole capture plus its analysis back to back. The analyzer overlaps the
+// two, so this is the worst case. The analysis time is measured on the
+// host unless --frame-us gives the target's.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "Spectrum.h"
+#include "song_toc.h"
+
+// As in LineInAnalyzer: 72 MHz / 8 ADC clock, 252 cycles per conversion
+static const double RAW_RATE_HZ = 9000000.0 / 252;
+// Captures a signal is held for before its levels count
+static const int SETTLE_CAPTURES = 4 * SPECTRUM_BIAS_FRAMES;
+static const uint32_t SAMPLE_RATE_HZ = (uint32_t)(RAW_RATE_HZ / SPECTRUM_DECIMATION);
+static const int RAW_SAMPLES = SPECTRUM_SIZE * SPECTRUM_DECIMATION;
+
+struct Tone {
+  double frequency;
+  double amplitude; // of full scale
+};
+
+static uint32_t noiseState = 12345;
+
+// Uniform in [-1, 1)
+static double noise() {
+  noiseState = noiseState * 1664525 + 1013904223;
+  return (noiseState >> 8) / (double)(1 << 23) - 1;
+}
+
+// A 12-bit capture around mid-scale, with an LSB of noise like a real ADC
+static void capture(uint16_t *raw, const Tone *tones, int count, double noiseAmplitude, double phase) {
+  for (int n = 0; n < RAW_SAMPLES; n++) {
+    double value = 0;
+    for (int t = 0; t < count; t++)
+      value += tones[t].amplitude * sin(2 * M_PI * tones[t].frequency * n / RAW_RATE_HZ + phase);
+    value = 2048 + value * 2047 + noiseAmplitude * 2047 * noise() + 0.5 * noise();
+    raw[n] = value < 0 ? 0 : value > 4095 ? 4095 : (uint16_t)value;
+  }
+}
+
+static void analyze(const SpectrumBands &bands, uint16_t *raw, uint8_t *levels, int32_t &biasQ4) {
+  int16_t *data = (int16_t *)raw;
+  spectrumPrepare(data, raw, biasQ4);
+  spectrumFft(data);
+  memset(levels, 0, SPECTRUM_BANDS);
+  bands.levels(data, levels);
+}
+
+// The levels of the last of SETTLE_CAPTURES captures of a steady signal,
+// each starting at another phase as the gaps between captures vary
+static void settle(const SpectrumBands &bands, const Tone *tones, int count, double noiseAmplitude,
+                   double phase, uint8_t *levels) {
+  static uint16_t raw[RAW_SAMPLES];
+  int32_t biasQ4 = 0;
+  for (int c = 0; c < SETTLE_CAPTURES; c++) {
+    capture(raw, tones, count, noiseAmplitude, phase + 2.39996 * c);
+    analyze(bands, raw, levels, biasQ4);
+  }
+}
+
+static int strongestBand(const uint8_t *levels) {
+  int best = 0;
+  for (int b = 1; b < SPECTRUM_BANDS; b++)
+    if (levels[b] > levels[best])
+      best = b;
+  return best;
+}
+
+static void printLevels(const char *label, const uint8_t *levels) {
+  printf("  %-22s", label);
+  for (int b = 0; b < SPECTRUM_BANDS; b++)
+    printf(" %3u", levels[b]);
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  int frames = 20000;
+  double targetFrameUs = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+      frames = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--frame-us") && i + 1 < argc) {
+      targetFrameUs = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [--frames N] [--frame-us U]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  SpectrumBands bands;
+  bands.begin(SAMPLE_RATE_HZ, song_band_boundaries);
+  printf("%d-point FFT at %u Hz, %.1f Hz per bin, %.1f ms per capture\n", SPECTRUM_SIZE, SAMPLE_RATE_HZ,
+         (double)SAMPLE_RATE_HZ / SPECTRUM_SIZE, 1000.0 * SPECTRUM_SIZE / SAMPLE_RATE_HZ);
+  printf("bins per band:");
+  for (int b = 0; b < SPECTRUM_BANDS; b++)
+    printf(" %u-%u", bands.firstBin(b), bands.lastBin(b));
+  printf("\n\n");
+
+  uint8_t levels[SPECTRUM_BANDS];
+  int failures = 0;
+
+  for (int b = 1; b < SPECTRUM_BANDS; b++) {
+    if (bands.firstBin(b) <= bands.lastBin(b - 1)) {
+      printf("! bands %d and %d share bins\n", b - 1, b);
+      failures++;
+    }
+  }
+
+  printf("band centres, -6 dB:\n");
+  for (int b = 0; b < SPECTRUM_BANDS; b++) {
+    Tone tone = {sqrt((double)song_band_boundaries[b] * song_band_boundaries[b + 1]), 0.5};
+    settle(bands, &tone, 1, 0, 0.3, levels);
+    int found = strongestBand(levels);
+    char label[32];
+    snprintf(label, sizeof(label), "%5.0f Hz -> band %2d%s", tone.frequency, found, found == b ? "" : " !");
+    printLevels(label, levels);
+    if (found != b)
+      failures++;
+  }
+
+  printf("\nother signals:\n");
+  Tone twoTones[] = {{440, 0.3}, {1760, 0.3}};
+  settle(bands, twoTones, 2, 0, 1.1, levels);
+  printLevels("440 + 1760 Hz", levels);
+  for (const Tone &tone : twoTones) {
+    int band = 0;
+    while (band < SPECTRUM_BANDS - 1 && tone.frequency >= song_band_boundaries[band + 1])
+      band++;
+    if (levels[band] < 128) {
+      printf("  ! %.0f Hz band %d too low\n", tone.frequency, band);
+      failures++;
+    }
+  }
+
+  settle(bands, nullptr, 0, 0, 0, levels);
+  printLevels("silence", levels);
+  for (int b = 0; b < SPECTRUM_BANDS; b++) {
+    if (levels[b] > 64) {
+      printf("  ! band %d lit by silence\n", b);
+      failures++;
+    }
+  }
+
+  Tone fullScale = {1000, 1.0};
+  settle(bands, &fullScale, 1, 0, 0.7, levels);
+  printLevels("1000 Hz full scale", levels);
+  if (levels[strongestBand(levels)] < 240) {
+    printf("  ! full scale reaches only %u\n", levels[strongestBand(levels)]);
+    failures++;
+  }
+
+  settle(bands, nullptr, 0, 0.3, 0, levels);
+  printLevels("white noise", levels);
+
+  // Host timing on captures that change every frame
+  static uint16_t raw[RAW_SAMPLES];
+  static uint16_t captures[8][RAW_SAMPLES];
+  for (int c = 0; c < 8; c++) {
+    Tone tone = {200.0 + 550 * c, 0.4};
+    capture(captures[c], &tone, 1, 0.05, c);
+  }
+  int32_t biasQ4 = 0;
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) {
+    memcpy(raw, captures[f & 7], sizeof(raw));
+    analyze(bands, raw, levels, biasQ4);
+    checksum += levels[f % SPECTRUM_BANDS];
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  int butterflies = SPECTRUM_SIZE / 2 * SPECTRUM_LOG2_SIZE;
+  double hostFrameUs = seconds * 1e6 / frames;
+  printf("\nhost: %d frames in %.3f s, %.2f us per frame (%d butterflies, checksum %u)\n", frames, seconds,
+         hostFrameUs, butterflies, checksum);
+
+  double captureUs = 1e6 * RAW_SAMPLES / RAW_RATE_HZ;
+  double frameUs = targetFrameUs > 0 ? targetFrameUs : hostFrameUs;
+  double framesPerSecond = 1e6 / (captureUs + frameUs);
+  printf("%.0f us capture + %.0f us analysis (%s): %.1f frames/s\n", captureUs, frameUs,
+         targetFrameUs > 0 ? "given" : "host", framesPerSecond);
+  if (framesPerSecond < 30) {
+    printf("! below 30 frames/s\n");
+    failures++;
+  }
+
+  printf("%s\n", failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Decode the player's binary telemetry and print periodic summaries.
+
+    python3 tools/telemetry.py /dev/ttyUSB0          # live, USB-serial on D8
+    python3 tools/telemetry.py --file capture.bin    # recorded stream
+
+The record format is described in lib/Telemetry/include/Telemetry.h. Live
+decoding needs pyserial.
+"""
+
+import argparse
+import struct
+import time
+
+BAUD = 1000000
+SYNC = 0xA5
+MAX_PAYLOAD = 16  # larger lengths can only be a false sync
+
+NOTE, FRAME, I2C, INPUT, LOOP_RATE, DROPPED, LATENCY = range(1, 8)
+INPUT_NAMES = {0: "skip", 1: "speed", 2: "pause"}
+
+
+class Decoder:
+    """Splits the byte stream into (type, payload), resyncing on bad checksums."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        self.buffer += data
+        while True:
+            start = self.buffer.find(bytes([SYNC]))
+            if start < 0:
+                self.buffer.clear()
+                return
+            del self.buffer[:start]
+            if len(self.buffer) < 3:
+                return
+            length = self.buffer[2]
+            if length > MAX_PAYLOAD:
+                self.bad += 1
+                del self.buffer[:1]
+                continue
+            if len(self.buffer) < length + 4:
+                return
+            record = self.buffer[1:length + 3]
+            if (~sum(record)) & 0xFF != self.buffer[length + 3]:
+                self.bad += 1
+                del self.buffer[:1]
+                continue
+            del self.buffer[:length + 4]
+            yield record[0], bytes(record[2:])
+
+
+class Summary:
+    def __init__(self):
+        self.reset()
+        self.dropped = 0
+
+    def reset(self):
+        self.lateness = []
+        self.frames = []
+        self.i2c = {}
+        self.inputs = {}
+        self.loop_rates = []
+        self.latencies = {}
+
+    def add(self, kind, payload, verbose):
+        if kind == NOTE:
+            song, note, scheduled, actual = struct.unpack("<BHII", payload)
+            late = ((actual - scheduled + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+            self.lateness.append(late)
+            if verbose:
+                print("note  song %d #%d late %+.2f ms" % (song, note, late / 1000))
+        elif kind == FRAME:
+            start, duration = struct.unpack("<IH", payload)
+            self.frames.append(duration)
+        elif kind == I2C:
+            address, length, wait, transfer = struct.unpack("<BHHH", payload)
+            stats = self.i2c.setdefault(address, [0, 0, [], []])
+            stats[0] += 1
+            stats[1] += length
+            stats[2].append(wait)
+            stats[3].append(transfer)
+        elif kind == INPUT:
+            which, value, at = struct.unpack("<BbI", payload)
+            name = INPUT_NAMES.get(which, str(which))
+            self.inputs[name] = self.inputs.get(name, 0) + 1
+            if verbose:
+                print("input %s %+d at %.3f s" % (name, value, at / 1e6))
+        elif kind == LOOP_RATE:
+            self.loop_rates.append(struct.unpack("<H", payload)[0])
+        elif kind == LATENCY:
+            which, at, audible, handled, note = struct.unpack("<BIHHI", payload)
+            name = INPUT_NAMES.get(which, str(which))
+            stages = self.latencies.setdefault(name, ([], [], []))
+            stages[0].append(audible)
+            stages[1].append(handled)
+            if note:
+                stages[2].append(note)
+            if verbose:
+                print("latency %s at %.3f s: audible %.2f ms, handled %.2f ms%s" % (
+                    name, at / 1e6, audible / 1000, handled / 1000,
+                    ", next note %.2f ms" % (note / 1000) if note else ""))
+        elif kind == DROPPED:
+            self.dropped += struct.unpack("<H", payload)[0]
+
+    def print(self, bad):
+        def spread(values, scale=1.0):
+            if not values:
+                return "-"
+            ordered = sorted(values)
+            p95 = ordered[min(len(ordered) - 1, int(len(ordered) * 0.95))]
+            return "avg %.2f p95 %.2f max %.2f" % (
+                sum(values) / len(values) / scale, p95 / scale, ordered[-1] / scale)
+
+        print("notes  %4d  late ms %s" % (len(self.lateness), spread(self.lateness, 1000)))
+        print("frames %4d  us %s" % (len(self.frames), spread(self.frames)))
+        for address, (count, length, waits, transfers) in sorted(self.i2c.items()):
+            print("i2c 0x%02X %4d tx %6d B  wait us %s  transfer us %s"
+                  % (address, count, length, spread(waits), spread(transfers)))
+        if self.inputs:
+            print("inputs " + ", ".join("%s %d" % item for item in sorted(self.inputs.items())))
+        for name, (audible, handled, note) in sorted(self.latencies.items()):
+            print("latency %-5s ms audible %s" % (name, spread(audible, 1000)))
+            print("              handled %s" % spread(handled, 1000))
+            if note:
+                print("              note    %s" % spread(note, 1000))
+        if self.loop_rates:
+            print("loops/s min %d last %d" % (min(self.loop_rates), self.loop_rates[-1]))
+        print("dropped %d records, %d bad checksums" % (self.dropped, bad))
+        print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", nargs="?")
+    parser.add_argument("--file", help="decode a recorded stream instead of a port")
+    parser.add_argument("--interval", type=float, default=5.0, help="seconds between summaries")
+    parser.add_argument("-v", "--verbose", action="store_true", help="also print notes and inputs")
+    args = parser.parse_args()
+
+    decoder = Decoder()
+    summary = Summary()
+
+    if args.file:
+        with open(args.file, "rb") as f:
+            for kind, payload in decoder.feed(f.read()):
+                summary.add(kind, payload, args.verbose)
+        summary.print(decoder.bad)
+        return
+
+    if not args.port:
+        parser.error("give a serial port or --file")
+
+    import serial
+
+    with serial.Serial(args.port, BAUD, timeout=0.1) as port:
+        last = time.monotonic()
+        try:
+            while True:
+                for kind, payload in decoder.feed(port.read(4096)):
+                    summary.add(kind, payload, args.verbose)
+                if time.monotonic() - last >= args.interval:
+                    summary.print(decoder.bad)
+                    summary.reset()
+                    last = time.monotonic()
+        except KeyboardInterrupt:
+            summary.print(decoder.bad)
+
+
+if __name__ == "__main__":
+    main()
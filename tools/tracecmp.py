@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""Compare playback traces against the ideal schedule of each song.
+
+    python3 tools/tracecmp.py trace.txt [--max-onset-ms 30] [--max-gap-ms 25]
+
+Traces come from the player's TRACE mode (Serial) or from tools/playsim.cpp,
+in the format of lib/PlaybackTrace. The ideal schedule is derived from the
+song sources with the firmware's own arithmetic (src/player.h, src/tempo.h):
+a note's score time is its noteDuration() in whole microseconds, its real
+time scoreToRealUs() of that at the speed in per mille, and every note
+starts when the previous one's real time ends.
+
+For every song and speed this prints:
+  onset     actual minus ideal start, relative to the first traced note or
+            the last pause / speed change (drift is the error at the end)
+  duration  actual minus ideal sounding time
+  gap       silence between a note's stop and the next start
+Exits with 1 when a --max-* limit is exceeded, so a timing regression fails
+a script.
+"""
+
+import argparse
+import os
+import sys
+
+from songsource import note_score_us, parse_song, score_to_real_us, song_list
+
+
+class Stats:
+    def __init__(self):
+        self.values = []
+
+    def add(self, value):
+        self.values.append(value)
+
+    def mean(self):
+        return sum(self.values) / len(self.values) if self.values else 0.0
+
+    def worst(self):
+        return max(self.values, key=abs) if self.values else 0.0
+
+
+class Result:
+    def __init__(self):
+        self.notes = 0
+        self.onset = Stats()
+        self.duration = Stats()
+        self.gap = Stats()
+        self.drift = 0.0
+
+
+def read_traces(path):
+    """Yields (song index, speed, [events]) per traced song."""
+    trace = None
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if not fields:
+                continue
+            if fields[0] == "song":
+                trace = (int(fields[2]), int(fields[3]), [])
+            elif trace and fields[0] in ("start", "stop", "anchor"):
+                trace[2].append((fields[0],) + tuple(int(v) for v in fields[1:]))
+            elif trace and fields[0] == "end":
+                yield trace
+                trace = None
+
+
+def ideal_schedule(path):
+    """Returns the score time per note in microseconds."""
+    _, tempo, values = parse_song(path)
+    return [note_score_us(values[k], tempo) for k in range(1, len(values), 2)]
+
+
+class RealSchedule:
+    """Ideal real start and length per note at one speed, in microseconds."""
+
+    def __init__(self, scores, speed):
+        self.durations = [score_to_real_us(score, speed) for score in scores]
+        self.starts = [0]
+        for duration in self.durations:
+            self.starts.append(self.starts[-1] + duration)
+
+
+def compare(events, speed, scores, results):
+    """Splits the trace at anchors and scores each part against the ideal."""
+    notes = {}
+    order = []
+    anchor_speed = speed
+    segment = 0
+    for event in events:
+        if event[0] == "anchor":
+            anchor_speed = event[3]
+            segment += 1
+        elif event[0] == "start":
+            _, time_us, note, _ = event
+            notes[note] = [time_us, None, segment, anchor_speed]
+            order.append(note)
+        elif event[0] == "stop" and event[2] in notes:
+            notes[event[2]][1] = event[1]
+
+    schedules = {}
+    anchor = None
+    previous = None
+    for note in order:
+        start_us, stop_us, segment, note_speed = notes[note]
+        if note >= len(scores):
+            continue
+        if note_speed not in schedules:
+            schedules[note_speed] = RealSchedule(scores, note_speed)
+        ideal = schedules[note_speed]
+        result = results.setdefault(note_speed, Result())
+        if anchor is None or anchor[2] != segment:
+            anchor = (note, start_us, segment)
+            previous = None
+
+        ideal_us = anchor[1] + ideal.starts[note] - ideal.starts[anchor[0]]
+        onset_ms = (start_us - ideal_us) / 1000
+        result.notes += 1
+        result.onset.add(onset_ms)
+        result.drift = onset_ms
+        if stop_us is not None:
+            result.duration.add((stop_us - start_us - ideal.durations[note]) / 1000)
+        if previous is not None and previous[1] is not None and previous[0] == note - 1:
+            result.gap.add((start_us - previous[1]) / 1000)
+        previous = (note, stop_us)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("trace")
+    parser.add_argument("--max-onset-ms", type=float)
+    parser.add_argument("--max-duration-ms", type=float)
+    parser.add_argument("--max-gap-ms", type=float)
+    args = parser.parse_args()
+
+    sources = song_list()
+    schedules = {}
+    failed = False
+
+    print("%-22s %6s %5s  %-23s   %-15s   %-15s" % ("song", "speed", "notes", "onset mean/worst/drift",
+                                                   "duration mean/worst", "gap mean/worst"))
+    for song, speed, events in read_traces(args.trace):
+        if song >= len(sources):
+            print("%-22s skipped, streamed songs have no source here" % ("#%d" % song))
+            continue
+        if song not in schedules:
+            schedules[song] = ideal_schedule(sources[song])
+        results = {}
+        compare(events, speed, schedules[song], results)
+
+        name = os.path.splitext(os.path.basename(sources[song]))[0]
+        for note_speed, result in sorted(results.items()):
+            limits = ((args.max_onset_ms, result.onset), (args.max_duration_ms, result.duration),
+                      (args.max_gap_ms, result.gap))
+            over = any(limit is not None and abs(stats.worst()) > limit for limit, stats in limits)
+            failed |= over
+            print("%-22s %5.2fx %5d  %7.2f %7.2f %7.2f   %7.2f %7.2f   %7.2f %7.2f%s" % (
+                name, note_speed / 1000, result.notes, result.onset.mean(), result.onset.worst(), result.drift,
+                result.duration.mean(), result.duration.worst(), result.gap.mean(), result.gap.worst(),
+                "  FAIL" if over else ""))
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
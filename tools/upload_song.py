@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Upload a song to a running player over the ST-Link serial port.
+
+    python3 tools/upload_song.py /dev/ttyACM0 lib/arduino-songs/src/tetris.cpp
+
+The song source uses the same format as lib/arduino-songs. It is packed into
+a one-song bank image (see lib/SongStream) and sent with the protocol in
+lib/SerialUpload. The player queues it to play after the current song.
+Needs pyserial.
+"""
+
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+import serial
+
+from songsource import note_duration_ms, parse_song
+
+BAUD = 921600
+BANK_MAGIC = 0x3142534E
+ENTRY_SIZE = 36
+NAME_SIZE = 24
+
+
+def pack(name, tempo, values):
+    notes = len(values) // 2
+    duration = sum(note_duration_ms(values[i * 2 + 1], tempo) for i in range(notes))
+    offset = 8 + ENTRY_SIZE
+    image = struct.pack("<IHH", BANK_MAGIC, 1, ENTRY_SIZE)
+    image += struct.pack("<IIHH", offset, int(duration), notes, tempo)
+    image += name.encode()[:NAME_SIZE - 1].ljust(NAME_SIZE, b"\0")
+    image += struct.pack("<%dh" % len(values), *values)
+    return image
+
+
+def expect(port, replies):
+    reply = port.read(1)
+    if reply not in replies:
+        sys.exit("unexpected reply %r" % reply)
+    return reply
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port")
+    parser.add_argument("song", help="song source, e.g. lib/arduino-songs/src/tetris.cpp")
+    args = parser.parse_args()
+
+    name, tempo, values = parse_song(args.song)
+    image = pack(name, tempo, values)
+
+    with serial.Serial(args.port, BAUD, timeout=2) as port:
+        start = time.monotonic()
+        port.write(b"NU" + struct.pack("<II", len(image), zlib.crc32(image)))
+        if expect(port, (b"R", b"B")) == b"B":
+            sys.exit("player busy or song too large (%d bytes)" % len(image))
+        port.write(image)
+        if expect(port, (b"K", b"E")) == b"E":
+            sys.exit("upload failed CRC check")
+        elapsed = time.monotonic() - start
+
+    print("%s: %d notes, %d bytes in %.0f ms" % (name, len(values) // 2, len(image), elapsed * 1000))
+
+
+if __name__ == "__main__":
+    main()